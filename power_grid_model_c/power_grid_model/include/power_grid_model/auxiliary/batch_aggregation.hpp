@@ -0,0 +1,111 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+// common parts of the aggregations of batch calculation results on the fly
+
+#include "../common/common.hpp"
+#include "../common/exception.hpp"
+#include "dataset.hpp"
+#include "meta_data.hpp"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace power_grid_model {
+
+// aggregation of batch results in thread-local partial results
+//    begin_batch creates a partial result for each thread, each with its own single scenario output dataset
+//    after each scenario, the scenario output is accumulated into the partial result of the thread
+//    end_batch merges the partial results of all threads
+template <typename T>
+concept batch_aggregation =
+    requires(T& aggregation, std::vector<typename T::Partial>& partials, typename T::Partial& partial,
+             meta_data::MetaData const& meta_data, std::map<std::string, Idx> const& component_count) {
+        {
+            aggregation.begin_batch(Idx{}, meta_data, std::string_view{}, component_count)
+        } -> std::same_as<std::vector<typename T::Partial>>;
+        { aggregation.end_batch(partials) };
+        { partial.scenario_output() } -> std::same_as<MutableDataset const&>;
+        { partial.accumulate(Idx{}) };
+    };
+
+namespace batch_aggregation_impl {
+
+struct ComponentBufferDeleter {
+    meta_data::MetaComponent const* component;
+    void operator()(meta_data::RawDataPtr ptr) const { component->destroy_buffer(ptr); }
+};
+using ComponentBufferPtr = std::unique_ptr<void, ComponentBufferDeleter>;
+
+// scenario output buffers of a single scenario, owned by a single thread
+class ScenarioOutput {
+  public:
+    ScenarioOutput(meta_data::MetaData const& meta_data, std::string_view output_dataset)
+        : dataset_{false, 1, output_dataset, meta_data} {}
+
+    MutableDataset const& dataset() const { return dataset_; }
+
+    // add the buffer of a component if it does not exist yet, return the pointer to the buffer
+    meta_data::RawDataConstPtr add_component(std::string_view component, Idx size) {
+        if (Idx const idx = dataset_.find_component(component); idx >= 0) {
+            return dataset_.get_buffer(idx).data;
+        }
+        auto const& meta_component = dataset_.dataset().get_component(component);
+        buffers_.emplace_back(meta_component.create_buffer(size), ComponentBufferDeleter{&meta_component});
+        dataset_.add_buffer(component, size, size, nullptr, buffers_.back().get());
+        return buffers_.back().get();
+    }
+
+  private:
+    std::vector<ComponentBufferPtr> buffers_;
+    MutableDataset dataset_;
+};
+
+// output attribute of a rule, resolved against the output dataset and the number of components in the model
+struct ResolvedAttribute {
+    meta_data::MetaComponent const* component;
+    meta_data::MetaAttribute const* attribute;
+    Idx n_elements;
+    Idx values_per_element;
+};
+
+// resolve the attribute of a rule of the aggregation with the given name
+//    only attributes of type double and double3 can be aggregated
+inline ResolvedAttribute resolve_attribute(std::string_view aggregation_name,
+                                           meta_data::MetaDataset const& meta_dataset,
+                                           std::string const& component_name, std::string const& attribute_name,
+                                           std::map<std::string, Idx> const& component_count) {
+    auto const& component = meta_dataset.get_component(component_name);
+    auto const& attribute = component.get_attribute(attribute_name);
+    if (attribute.ctype != CType::c_double && attribute.ctype != CType::c_double3) {
+        throw InvalidArguments{
+            std::string{aggregation_name},
+            InvalidArguments::TypeValuePair{.name = "attribute", .value = component_name + "." + attribute_name}};
+    }
+    auto const found = component_count.find(component_name);
+    return {.component = &component,
+            .attribute = &attribute,
+            .n_elements = found == component_count.cend() ? 0 : found->second,
+            .values_per_element = attribute.ctype == CType::c_double3 ? 3 : 1};
+}
+
+// create the partial results of all threads
+template <typename MakePartial>
+auto make_partials(Idx n_partials, MakePartial make_partial) -> std::vector<decltype(make_partial())> {
+    std::vector<decltype(make_partial())> partials;
+    partials.reserve(n_partials);
+    for (Idx i = 0; i != n_partials; ++i) {
+        partials.push_back(make_partial());
+    }
+    return partials;
+}
+
+} // namespace batch_aggregation_impl
+
+} // namespace power_grid_model
@@ -0,0 +1,292 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+// on-the-fly reduction of batch calculation results per component attribute
+
+#include "../common/common.hpp"
+#include "../common/enum.hpp"
+#include "../common/exception.hpp"
+#include "../common/three_phase_tensor.hpp"
+#include "batch_aggregation.hpp"
+#include "dataset.hpp"
+#include "meta_data.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <string>
+#include <string_view>
+
+namespace power_grid_model {
+
+// reduction of one output attribute of one component type over all scenarios of a batch
+//    the attribute should be of type double or double3, nan values are skipped
+// percentiles are given in percent and are approximated by counting the values in n_bins equidistant bins
+//    between lower and upper, values outside of this range are counted in the outer bins
+//    the error within the range is at most one bin width
+//    each thread counts n_bins per value, so n_bins is limited to max_n_bins
+struct BatchReductionRule {
+    static constexpr Idx max_n_bins = 1000;
+
+    std::string component;
+    std::string attribute;
+    ReductionType type{ReductionType::mean};
+    double percentile{50.0};
+    double lower{0.0};
+    double upper{0.0};
+    Idx n_bins{100};
+};
+
+class BatchReduction {
+    using ResolvedRule = batch_aggregation_impl::ResolvedAttribute;
+
+    // accumulated values of a rule
+    //    minimum/maximum: extreme value per value
+    //    mean: sum per value
+    //    percentile: bin counts, n_bins per value
+    struct RuleState {
+        DoubleVector values;
+        IdxVector counts;
+    };
+
+  public:
+    // partial results of the scenarios calculated by a single thread
+    class Partial {
+      public:
+        MutableDataset const& scenario_output() const { return scenario_output_.dataset(); }
+
+        // accumulate the current content of the scenario output
+        void accumulate(Idx /* scenario_idx */) {
+            for (Idx rule_idx = 0; rule_idx != std::ssize(reduction_->rules_); ++rule_idx) {
+                meta_data::ctype_func_selector(reduction_->resolved_[rule_idx].attribute->ctype,
+                                               [this, rule_idx]<class T> { accumulate_rule<T>(rule_idx); });
+            }
+        }
+
+      private:
+        friend class BatchReduction;
+
+        BatchReduction const* reduction_;
+        batch_aggregation_impl::ScenarioOutput scenario_output_;
+        std::vector<meta_data::RawDataConstPtr> rule_buffers_;
+        std::vector<RuleState> states_;
+
+        Partial(BatchReduction const& reduction, meta_data::MetaData const& meta_data,
+                std::string_view output_dataset)
+            : reduction_{&reduction}, scenario_output_{meta_data, output_dataset} {
+            for (Idx rule_idx = 0; rule_idx != std::ssize(reduction.rules_); ++rule_idx) {
+                BatchReductionRule const& rule = reduction.rules_[rule_idx];
+                ResolvedRule const& resolved = reduction.resolved_[rule_idx];
+                rule_buffers_.push_back(scenario_output_.add_component(rule.component, resolved.n_elements));
+
+                Idx const n_values = resolved.n_elements * resolved.values_per_element;
+                switch (rule.type) {
+                    using enum ReductionType;
+                case minimum:
+                    states_.push_back({DoubleVector(n_values, std::numeric_limits<double>::infinity()),
+                                       IdxVector(n_values, 0)});
+                    break;
+                case maximum:
+                    states_.push_back({DoubleVector(n_values, -std::numeric_limits<double>::infinity()),
+                                       IdxVector(n_values, 0)});
+                    break;
+                case mean:
+                    states_.push_back({DoubleVector(n_values, 0.0), IdxVector(n_values, 0)});
+                    break;
+                case percentile:
+                    states_.push_back({DoubleVector{}, IdxVector(n_values * rule.n_bins, 0)});
+                    break;
+                default:
+                    throw MissingCaseForEnumError{"BatchReduction", rule.type};
+                }
+            }
+        }
+
+        template <class T> void accumulate_rule(Idx rule_idx) {
+            if constexpr (std::same_as<T, double> || std::same_as<T, RealValue<asymmetric_t>>) {
+                ResolvedRule const& resolved = reduction_->resolved_[rule_idx];
+                BatchReductionRule const& rule = reduction_->rules_[rule_idx];
+                RuleState& state = states_[rule_idx];
+                for (Idx element = 0; element != resolved.n_elements; ++element) {
+                    T const& value = resolved.attribute->get_attribute<T const>(
+                        resolved.component->advance_ptr(rule_buffers_[rule_idx], element));
+                    if constexpr (std::same_as<T, double>) {
+                        add_value(rule, state, element, value);
+                    } else {
+                        for (Idx phase = 0; phase != 3; ++phase) {
+                            add_value(rule, state, element * 3 + phase, value(phase));
+                        }
+                    }
+                }
+            } else {
+                assert(false); // rejected when resolving the rules
+            }
+        }
+
+        static void add_value(BatchReductionRule const& rule, RuleState& state, Idx value_idx, double value) {
+            if (is_nan(value)) {
+                return;
+            }
+            switch (rule.type) {
+                using enum ReductionType;
+            case minimum:
+                state.values[value_idx] = std::min(state.values[value_idx], value);
+                break;
+            case maximum:
+                state.values[value_idx] = std::max(state.values[value_idx], value);
+                break;
+            case mean:
+                state.values[value_idx] += value;
+                break;
+            case percentile: {
+                // clamp before the conversion, which is undefined for infinite or out-of-range values
+                double const n_bins = static_cast<double>(rule.n_bins);
+                double const position = std::floor((value - rule.lower) / (rule.upper - rule.lower) * n_bins);
+                auto const bin = static_cast<Idx>(std::clamp(position, 0.0, n_bins - 1.0));
+                ++state.counts[value_idx * rule.n_bins + bin];
+                return;
+            }
+            default:
+                throw MissingCaseForEnumError{"BatchReduction", rule.type};
+            }
+            ++state.counts[value_idx];
+        }
+
+        void merge(Partial const& other) {
+            for (Idx rule_idx = 0; rule_idx != std::ssize(states_); ++rule_idx) {
+                RuleState& state = states_[rule_idx];
+                RuleState const& other_state = other.states_[rule_idx];
+                switch (reduction_->rules_[rule_idx].type) {
+                    using enum ReductionType;
+                case minimum:
+                    std::ranges::transform(state.values, other_state.values, state.values.begin(),
+                                           [](double x, double y) { return std::min(x, y); });
+                    break;
+                case maximum:
+                    std::ranges::transform(state.values, other_state.values, state.values.begin(),
+                                           [](double x, double y) { return std::max(x, y); });
+                    break;
+                case mean:
+                    std::ranges::transform(state.values, other_state.values, state.values.begin(), std::plus{});
+                    break;
+                default:
+                    break;
+                }
+                std::ranges::transform(state.counts, other_state.counts, state.counts.begin(), std::plus{});
+            }
+        }
+    };
+
+    explicit BatchReduction(std::vector<BatchReductionRule> rules) : rules_{std::move(rules)} {
+        using TypeValuePair = InvalidArguments::TypeValuePair;
+        for (BatchReductionRule const& rule : rules_) {
+            if (rule.type != ReductionType::percentile) {
+                continue;
+            }
+            if (!(rule.percentile >= 0.0 && rule.percentile <= 100.0)) {
+                throw InvalidArguments{"BatchReduction",
+                                       TypeValuePair{.name = "percentile", .value = std::to_string(rule.percentile)}};
+            }
+            if (!(rule.lower < rule.upper) || rule.n_bins < 1 || rule.n_bins > BatchReductionRule::max_n_bins) {
+                throw InvalidArguments{
+                    "BatchReduction", TypeValuePair{.name = "lower", .value = std::to_string(rule.lower)},
+                    TypeValuePair{.name = "upper", .value = std::to_string(rule.upper)},
+                    TypeValuePair{.name = "n_bins", .value = std::to_string(rule.n_bins)}};
+            }
+        }
+    }
+
+    std::vector<BatchReductionRule> const& rules() const { return rules_; }
+
+    // reduced values of a rule
+    //    for each element of the component in sequence order, values_per_element consecutive values
+    //    the result is nan if there is no valid value for the element
+    DoubleVector const& result(Idx rule_idx) const { return results_[rule_idx]; }
+    // whether the reduced values of the last batch are available
+    bool has_result() const { return results_.size() == rules_.size(); }
+    Idx values_per_element(Idx rule_idx) const { return resolved_[rule_idx].values_per_element; }
+
+    // resolve the rules against the output dataset and create the partial results for each thread
+    std::vector<Partial> begin_batch(Idx n_partials, meta_data::MetaData const& meta_data,
+                                     std::string_view output_dataset,
+                                     std::map<std::string, Idx> const& component_count) {
+        auto const& meta_dataset = meta_data.get_dataset(output_dataset);
+        resolved_.clear();
+        results_.clear();
+        for (BatchReductionRule const& rule : rules_) {
+            resolved_.push_back(batch_aggregation_impl::resolve_attribute(
+                "BatchReduction", meta_dataset, rule.component, rule.attribute, component_count));
+        }
+        return batch_aggregation_impl::make_partials(
+            n_partials, [this, &meta_data, output_dataset] { return Partial{*this, meta_data, output_dataset}; });
+    }
+
+    // merge the partial results of all threads and calculate the reduced values
+    void end_batch(std::vector<Partial>& partials) {
+        if (partials.empty()) {
+            return;
+        }
+        Partial& total = partials.front();
+        std::for_each(partials.cbegin() + 1, partials.cend(), [&total](Partial const& other) { total.merge(other); });
+
+        results_.resize(rules_.size());
+        for (Idx rule_idx = 0; rule_idx != std::ssize(rules_); ++rule_idx) {
+            BatchReductionRule const& rule = rules_[rule_idx];
+            RuleState const& state = total.states_[rule_idx];
+            Idx const n_values = resolved_[rule_idx].n_elements * resolved_[rule_idx].values_per_element;
+            DoubleVector& result = results_[rule_idx];
+            result.resize(n_values);
+            for (Idx value_idx = 0; value_idx != n_values; ++value_idx) {
+                result[value_idx] = rule.type == ReductionType::percentile
+                                        ? percentile_from_bins(rule, state, value_idx)
+                                        : reduced_value(rule, state, value_idx);
+            }
+        }
+    }
+
+  private:
+    std::vector<BatchReductionRule> rules_;
+    std::vector<ResolvedRule> resolved_;
+    std::vector<DoubleVector> results_;
+
+    static double reduced_value(BatchReductionRule const& rule, RuleState const& state, Idx value_idx) {
+        Idx const count = state.counts[value_idx];
+        if (count == 0) {
+            return nan;
+        }
+        return rule.type == ReductionType::mean ? state.values[value_idx] / static_cast<double>(count)
+                                                : state.values[value_idx];
+    }
+
+    // linear interpolation within the bin containing the requested percentile
+    static double percentile_from_bins(BatchReductionRule const& rule, RuleState const& state, Idx value_idx) {
+        auto const bins_begin = state.counts.cbegin() + value_idx * rule.n_bins;
+        auto const bins_end = bins_begin + rule.n_bins;
+        Idx const count = std::reduce(bins_begin, bins_end, Idx{0});
+        if (count == 0) {
+            return nan;
+        }
+        double const target = rule.percentile / 100.0 * static_cast<double>(count);
+        double const bin_width = (rule.upper - rule.lower) / static_cast<double>(rule.n_bins);
+        Idx cumulative{0};
+        for (auto it = bins_begin; it != bins_end; ++it) {
+            if (*it == 0 || static_cast<double>(cumulative + *it) < target) {
+                cumulative += *it;
+                continue;
+            }
+            double const fraction = (target - static_cast<double>(cumulative)) / static_cast<double>(*it);
+            return rule.lower + (static_cast<double>(std::distance(bins_begin, it)) + fraction) * bin_width;
+        }
+        return rule.upper;
+    }
+};
+
+static_assert(batch_aggregation<BatchReduction>);
+
+} // namespace power_grid_model
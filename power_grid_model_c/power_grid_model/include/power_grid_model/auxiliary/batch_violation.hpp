@@ -0,0 +1,171 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+// sparse screening of batch calculation results against threshold rules
+
+#include "../common/common.hpp"
+#include "../common/exception.hpp"
+#include "../common/three_phase_tensor.hpp"
+#include "batch_aggregation.hpp"
+#include "dataset.hpp"
+#include "meta_data.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <string>
+#include <string_view>
+
+namespace power_grid_model {
+
+// threshold rule on one output attribute of one component type
+//    a value violates the rule if it is strictly below lower or strictly above upper
+//    the attribute should be of type double or double3, nan values never violate a rule
+struct ViolationRule {
+    std::string component;
+    std::string attribute;
+    double lower{-std::numeric_limits<double>::infinity()};
+    double upper{std::numeric_limits<double>::infinity()};
+};
+
+// a single violation of a rule
+//    phase is 0 for attributes of type double and the phase index for attributes of type double3
+struct Violation {
+    Idx scenario;
+    ID id;
+    Idx rule;
+    IntS phase;
+    double value;
+};
+
+class ViolationScreening {
+    // rule resolved against the output dataset and the number of components in the model,
+    // with the id attribute to report the violating components
+    struct ResolvedRule : batch_aggregation_impl::ResolvedAttribute {
+        meta_data::MetaAttribute const* id;
+    };
+
+  public:
+    // violations found in the scenarios calculated by a single thread, in order of calculation
+    class Partial {
+      public:
+        MutableDataset const& scenario_output() const { return scenario_output_.dataset(); }
+
+        // screen the current content of the scenario output
+        void accumulate(Idx scenario_idx) {
+            for (Idx rule_idx = 0; rule_idx != std::ssize(screening_->rules_); ++rule_idx) {
+                meta_data::ctype_func_selector(
+                    screening_->resolved_[rule_idx].attribute->ctype,
+                    [this, scenario_idx, rule_idx]<class T> { screen_rule<T>(scenario_idx, rule_idx); });
+            }
+        }
+
+      private:
+        friend class ViolationScreening;
+
+        ViolationScreening const* screening_;
+        batch_aggregation_impl::ScenarioOutput scenario_output_;
+        std::vector<meta_data::RawDataConstPtr> rule_buffers_;
+        std::vector<Violation> violations_;
+
+        Partial(ViolationScreening const& screening, meta_data::MetaData const& meta_data,
+                std::string_view output_dataset)
+            : screening_{&screening}, scenario_output_{meta_data, output_dataset} {
+            for (Idx rule_idx = 0; rule_idx != std::ssize(screening.rules_); ++rule_idx) {
+                rule_buffers_.push_back(scenario_output_.add_component(screening.rules_[rule_idx].component,
+                                                                       screening.resolved_[rule_idx].n_elements));
+            }
+        }
+
+        template <class T> void screen_rule(Idx scenario_idx, Idx rule_idx) {
+            if constexpr (std::same_as<T, double> || std::same_as<T, RealValue<asymmetric_t>>) {
+                ResolvedRule const& resolved = screening_->resolved_[rule_idx];
+                ViolationRule const& rule = screening_->rules_[rule_idx];
+                for (Idx element = 0; element != resolved.n_elements; ++element) {
+                    auto const element_ptr = resolved.component->advance_ptr(rule_buffers_[rule_idx], element);
+                    T const& value = resolved.attribute->get_attribute<T const>(element_ptr);
+                    auto const add_violation = [&](IntS phase, double phase_value) {
+                        if (phase_value < rule.lower || phase_value > rule.upper) {
+                            violations_.push_back({.scenario = scenario_idx,
+                                                   .id = resolved.id->get_attribute<ID const>(element_ptr),
+                                                   .rule = rule_idx,
+                                                   .phase = phase,
+                                                   .value = phase_value});
+                        }
+                    };
+                    if constexpr (std::same_as<T, double>) {
+                        add_violation(0, value);
+                    } else {
+                        for (IntS phase = 0; phase != 3; ++phase) {
+                            add_violation(phase, value(phase));
+                        }
+                    }
+                }
+            } else {
+                assert(false); // rejected when resolving the rules
+            }
+        }
+    };
+
+    explicit ViolationScreening(std::vector<ViolationRule> rules) : rules_{std::move(rules)} {
+        for (ViolationRule const& rule : rules_) {
+            if (is_nan(rule.lower) || is_nan(rule.upper) || rule.lower > rule.upper) {
+                using TypeValuePair = InvalidArguments::TypeValuePair;
+                throw InvalidArguments{"ViolationScreening",
+                                       TypeValuePair{.name = "lower", .value = std::to_string(rule.lower)},
+                                       TypeValuePair{.name = "upper", .value = std::to_string(rule.upper)}};
+            }
+        }
+    }
+
+    std::vector<ViolationRule> const& rules() const { return rules_; }
+
+    // all violations of the batch, sorted by scenario
+    //    within a scenario, the violations are ordered by rule, element in sequence order and phase
+    std::vector<Violation> const& violations() const { return violations_; }
+
+    // resolve the rules against the output dataset and create the partial results for each thread
+    std::vector<Partial> begin_batch(Idx n_partials, meta_data::MetaData const& meta_data,
+                                     std::string_view output_dataset,
+                                     std::map<std::string, Idx> const& component_count) {
+        auto const& meta_dataset = meta_data.get_dataset(output_dataset);
+        resolved_.clear();
+        violations_.clear();
+        for (ViolationRule const& rule : rules_) {
+            auto const attribute = batch_aggregation_impl::resolve_attribute("ViolationScreening", meta_dataset,
+                                                                             rule.component, rule.attribute,
+                                                                             component_count);
+            resolved_.push_back({attribute, &attribute.component->get_attribute("id")});
+        }
+        return batch_aggregation_impl::make_partials(
+            n_partials, [this, &meta_data, output_dataset] { return Partial{*this, meta_data, output_dataset}; });
+    }
+
+    // collect the violations of all threads
+    //    each thread calculates its scenarios in increasing order, so a stable sort on the scenario suffices
+    void end_batch(std::vector<Partial>& partials) {
+        size_t n_violations{0};
+        for (Partial const& partial : partials) {
+            n_violations += partial.violations_.size();
+        }
+        violations_.reserve(n_violations);
+        for (Partial& partial : partials) {
+            std::ranges::move(partial.violations_, std::back_inserter(violations_));
+            partial.violations_.clear();
+        }
+        std::ranges::stable_sort(violations_, {}, &Violation::scenario);
+    }
+
+  private:
+    std::vector<ViolationRule> rules_;
+    std::vector<ResolvedRule> resolved_;
+    std::vector<Violation> violations_;
+};
+
+static_assert(batch_aggregation<ViolationScreening>);
+
+} // namespace power_grid_model
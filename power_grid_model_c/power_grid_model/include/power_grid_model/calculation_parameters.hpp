@@ -182,6 +182,8 @@ struct MathModelTopology {
     Idx n_bus_power_sensor() const { return power_sensors_per_bus.element_size(); }
 
     Idx n_transformer_tap_regulator() const { return tap_regulators_per_branch.element_size(); }
+
+    friend bool operator==(MathModelTopology const& x, MathModelTopology const& y) = default;
 };
 
 template <symmetry_tag sym_type> struct MathModelParam {
@@ -202,6 +204,7 @@ template <symmetry_tag sym_type> struct PowerFlowInput {
 
     ComplexVector source;                // Complex u_ref of each source
     ComplexValueVector<sym> s_injection; // Specified injection power of each load_gen
+    ComplexValueVector<sym> initial_u;   // Optional initial guess of the voltage of each bus, empty for a cold start
 };
 
 template <symmetry_tag sym_type> struct StateEstimationInput {
@@ -114,6 +114,14 @@ enum class OptimizerStrategy : IntS { // Conventions for optimization strategies
     global_maximum = 2,               // global_maximum = argmax{f(x) \in Range} for x in Domain
     local_minimum = 3,                // local_minimum = Any{argmin{f(x) \in Range}} for x in Domain
     local_maximum = 4,                // local_maximum = Any{argmax{f(x) \in Range}} for x in Domain
+    fast_any = 5,                     // fast_any = any, searched by predicting x from the sensitivity df/dx
+};
+
+enum class ReductionType : IntS { // statistics reduced over the scenarios of a batch
+    minimum = 0,
+    maximum = 1,
+    mean = 2,
+    percentile = 3,
 };
 
 } // namespace power_grid_model
@@ -113,6 +113,21 @@ class SparseMatrixError : public PowerGridError {
 class NotObservableError : public PowerGridError {
   public:
     NotObservableError() { append_msg("Not enough measurements available for state estimation.\n"); }
+    // bus_island: the observable island of each bus of the math model
+    NotObservableError(Idx n_islands, IdxVector bus_island)
+        : n_islands_{n_islands}, bus_island_{std::move(bus_island)} {
+        append_msg("Not enough measurements available for state estimation.\n");
+        append_msg("The " + detail::to_string(std::ssize(bus_island_)) + " buses are divided into " +
+                   detail::to_string(n_islands_) + " observable island(s).\n");
+    }
+
+    Idx n_islands() const { return n_islands_; }
+
+    IdxVector const& bus_island() const { return bus_island_; }
+
+  private:
+    Idx n_islands_{};
+    IdxVector bus_island_;
 };
 
 class IterationDiverge : public PowerGridError {
@@ -174,6 +189,15 @@ class AutomaticTapCalculationError : public PowerGridError {
     }
 };
 
+class ReferencedComponentRemoval : public PowerGridError {
+  public:
+    ReferencedComponentRemoval(ID id, ID referencing_id) {
+        append_msg("The component with id " + detail::to_string(id) +
+                   " cannot be removed, it is referenced by the component with id " +
+                   detail::to_string(referencing_id) + '\n');
+    }
+};
+
 class IDWrongType : public PowerGridError {
   public:
     explicit IDWrongType(ID id) { append_msg("Wrong type for object with id " + detail::to_string(id) + '\n'); }
@@ -0,0 +1,285 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+/*
+Index from the ID of a component to its Idx2D in the container
+
+The index is kept in one flat array in either of two layouts
+    - hash: open addressing with linear probing, the capacity is a power of two and at least twice the size
+    - dense: the Idx2D of ID (min_id + k) is stored at position k
+The dense layout is chosen by compact() if the IDs form an (almost) compact range, which is common for generated models.
+An empty slot has group -1.
+*/
+
+#include "common.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace power_grid_model {
+
+namespace id_index_impl {
+
+inline void prefetch(void const* address) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address);
+#else
+    (void)address;
+#endif
+}
+
+} // namespace id_index_impl
+
+class IdIndex {
+  public:
+    static constexpr Idx2D not_found{.group = -1, .pos = -1};
+    // the dense layout is used if the range of the IDs is at most this factor times the number of IDs
+    static constexpr Idx max_dense_spread = 2;
+
+    Idx size() const { return size_; }
+    bool is_dense() const { return is_dense_; }
+    bool contains(ID id) const { return find(id) != not_found; }
+
+    // get the Idx2D of the ID, not_found if the ID does not exist
+    Idx2D find(ID id) const {
+        if (is_dense_) {
+            auto const offset = dense_offset(id);
+            return offset < dense_slots_.size() ? dense_slots_[offset] : not_found;
+        }
+        if (slots_.empty()) {
+            return not_found;
+        }
+        return probe(id, home_slot(id));
+    }
+
+    // get the Idx2D of all IDs at once, not_found for the IDs which do not exist
+    //    the slots of a block of IDs are prefetched before they are probed
+    void find(std::span<ID const> ids, std::span<Idx2D> result) const {
+        assert(ids.size() == result.size());
+        if (is_dense_ || slots_.empty()) {
+            std::ranges::transform(ids, result.begin(), [this](ID id) { return find(id); });
+            return;
+        }
+        constexpr size_t block_size = 16;
+        std::array<size_t, block_size> home_slots{};
+        for (size_t block_begin = 0; block_begin < ids.size(); block_begin += block_size) {
+            size_t const n_block = std::min(block_size, ids.size() - block_begin);
+            for (size_t i = 0; i != n_block; ++i) {
+                home_slots[i] = home_slot(ids[block_begin + i]);
+                id_index_impl::prefetch(&slots_[home_slots[i]]);
+            }
+            for (size_t i = 0; i != n_block; ++i) {
+                result[block_begin + i] = probe(ids[block_begin + i], home_slots[i]);
+            }
+        }
+    }
+
+    // insert a new ID, return false without changes if the ID already exists
+    bool insert(ID id, Idx2D idx) {
+        assert(idx.group >= 0);
+        if (is_dense_) {
+            auto const offset = dense_offset(id);
+            if (offset < dense_slots_.size()) {
+                if (dense_slots_[offset] != not_found) {
+                    return false;
+                }
+                dense_slots_[offset] = idx;
+                ++size_;
+                return true;
+            }
+            // the ID is out of the dense range
+            to_hash();
+        }
+        reserve(size_ + 1);
+        for (size_t slot = home_slot(id);; slot = next_slot(slot)) {
+            Entry& entry = slots_[slot];
+            if (entry.idx == not_found) {
+                entry = Entry{.id = id, .idx = idx};
+                ++size_;
+                return true;
+            }
+            if (entry.id == id) {
+                return false;
+            }
+        }
+    }
+
+    // change the Idx2D of an existing ID, return false if the ID does not exist
+    bool assign(ID id, Idx2D idx) {
+        assert(idx.group >= 0);
+        if (Idx2D* const found = find_slot(id); found != nullptr) {
+            *found = idx;
+            return true;
+        }
+        return false;
+    }
+
+    // remove an ID, return false if the ID does not exist
+    //    in the hash layout, the following entries of the probe sequence are shifted back into the hole
+    bool erase(ID id) {
+        if (is_dense_) {
+            Idx2D* const found = find_slot(id);
+            if (found == nullptr) {
+                return false;
+            }
+            *found = not_found;
+            --size_;
+            return true;
+        }
+        if (slots_.empty()) {
+            return false;
+        }
+        size_t hole = home_slot(id);
+        while (slots_[hole].idx != not_found && slots_[hole].id != id) {
+            hole = next_slot(hole);
+        }
+        if (slots_[hole].idx == not_found) {
+            return false;
+        }
+        size_t const mask = slots_.size() - 1;
+        for (size_t slot = next_slot(hole); slots_[slot].idx != not_found; slot = next_slot(slot)) {
+            // the entry can move to the hole if the hole is between its home slot and its current slot
+            size_t const home = home_slot(slots_[slot].id);
+            if (((slot - home) & mask) >= ((slot - hole) & mask)) {
+                slots_[hole] = slots_[slot];
+                hole = slot;
+            }
+        }
+        slots_[hole] = Entry{};
+        --size_;
+        return true;
+    }
+
+    // reserve the hash table for the number of IDs
+    void reserve(Idx n) {
+        if (is_dense_) {
+            return;
+        }
+        auto const capacity = std::bit_ceil(static_cast<size_t>(std::max(n, Idx{4}) * 2));
+        if (capacity > slots_.size()) {
+            rehash(capacity);
+        }
+    }
+
+    // switch to the dense layout if the IDs are compact enough
+    void compact() {
+        if (is_dense_ || size_ == 0) {
+            return;
+        }
+        auto min_id = std::numeric_limits<ID>::max();
+        auto max_id = std::numeric_limits<ID>::min();
+        for (Entry const& entry : slots_) {
+            if (entry.idx != not_found) {
+                min_id = std::min(min_id, entry.id);
+                max_id = std::max(max_id, entry.id);
+            }
+        }
+        Idx const spread = Idx{max_id} - Idx{min_id} + 1;
+        if (spread > max_dense_spread * size_) {
+            return;
+        }
+        dense_slots_.assign(static_cast<size_t>(spread), not_found);
+        for (Entry const& entry : slots_) {
+            if (entry.idx != not_found) {
+                dense_slots_[static_cast<size_t>(Idx{entry.id} - Idx{min_id})] = entry.idx;
+            }
+        }
+        min_id_ = min_id;
+        is_dense_ = true;
+        slots_ = {};
+    }
+
+  private:
+    struct Entry {
+        ID id{};
+        Idx2D idx{not_found};
+    };
+
+    Idx size_{};
+    bool is_dense_{false};
+    // hash layout
+    std::vector<Entry> slots_;
+    int hash_shift_{std::numeric_limits<uint64_t>::digits};
+    // dense layout
+    std::vector<Idx2D> dense_slots_;
+    ID min_id_{};
+
+    // Fibonacci hashing, the upper bits of the product are the best mixed
+    size_t home_slot(ID id) const {
+        constexpr uint64_t golden_ratio = 0x9E3779B97F4A7C15;
+        return static_cast<size_t>((static_cast<uint64_t>(static_cast<uint32_t>(id)) * golden_ratio) >> hash_shift_);
+    }
+    size_t next_slot(size_t slot) const { return (slot + 1) & (slots_.size() - 1); }
+    // an ID below the range wraps around to a large offset
+    size_t dense_offset(ID id) const { return static_cast<size_t>(Idx{id} - Idx{min_id_}); }
+
+    // the stored Idx2D of the ID, nullptr if the ID does not exist
+    Idx2D* find_slot(ID id) {
+        if (is_dense_) {
+            auto const offset = dense_offset(id);
+            return offset < dense_slots_.size() && dense_slots_[offset] != not_found ? &dense_slots_[offset] : nullptr;
+        }
+        if (slots_.empty()) {
+            return nullptr;
+        }
+        for (size_t slot = home_slot(id);; slot = next_slot(slot)) {
+            Entry& entry = slots_[slot];
+            if (entry.idx == not_found) {
+                return nullptr;
+            }
+            if (entry.id == id) {
+                return &entry.idx;
+            }
+        }
+    }
+
+    Idx2D probe(ID id, size_t slot) const {
+        for (;; slot = next_slot(slot)) {
+            Entry const& entry = slots_[slot];
+            if (entry.idx == not_found || entry.id == id) {
+                return entry.idx;
+            }
+        }
+    }
+
+    void rehash(size_t capacity) {
+        assert(std::has_single_bit(capacity));
+        std::vector<Entry> old_slots(capacity);
+        old_slots.swap(slots_);
+        hash_shift_ = std::numeric_limits<uint64_t>::digits - std::countr_zero(capacity);
+        for (Entry const& entry : old_slots) {
+            if (entry.idx != not_found) {
+                size_t slot = home_slot(entry.id);
+                while (slots_[slot].idx != not_found) {
+                    slot = next_slot(slot);
+                }
+                slots_[slot] = entry;
+            }
+        }
+    }
+
+    void to_hash() {
+        assert(is_dense_);
+        std::vector<Idx2D> const dense_slots = std::move(dense_slots_);
+        dense_slots_ = {};
+        is_dense_ = false;
+        size_ = 0;
+        reserve(static_cast<Idx>(dense_slots.size()));
+        for (size_t offset = 0; offset != dense_slots.size(); ++offset) {
+            if (dense_slots[offset] != not_found) {
+                insert(static_cast<ID>(Idx{min_id_} + static_cast<Idx>(offset)), dense_slots[offset]);
+            }
+        }
+    }
+};
+
+} // namespace power_grid_model
@@ -66,7 +66,7 @@ class GenericPowerSensor : public Sensor {
     virtual PowerSensorOutput<asymmetric_t> get_asym_output(ComplexValue<asymmetric_t> const& s) const = 0;
 };
 
-template <symmetry_tag power_sensor_symmetry_> class PowerSensor : public GenericPowerSensor {
+template <symmetry_tag power_sensor_symmetry_> class PowerSensor final : public GenericPowerSensor {
   public:
     using power_sensor_symmetry = power_sensor_symmetry_;
 
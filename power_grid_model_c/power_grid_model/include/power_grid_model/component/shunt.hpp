@@ -16,7 +16,7 @@
 
 namespace power_grid_model {
 
-class Shunt : public Appliance {
+class Shunt final : public Appliance {
   public:
     using InputType = ShuntInput;
     using UpdateType = ShuntUpdate;
@@ -10,7 +10,7 @@
 
 namespace power_grid_model {
 
-class ThreeWindingTransformer : public Branch3 {
+class ThreeWindingTransformer final : public Branch3 {
   public:
     using InputType = ThreeWindingTransformerInput;
     using UpdateType = ThreeWindingTransformerUpdate;
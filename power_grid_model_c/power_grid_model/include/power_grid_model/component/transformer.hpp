@@ -17,7 +17,7 @@
 
 namespace power_grid_model {
 
-class Transformer : public Branch {
+class Transformer final : public Branch {
   public:
     using InputType = TransformerInput;
     using UpdateType = TransformerUpdate;
@@ -15,7 +15,7 @@
 
 namespace power_grid_model {
 
-class TransformerTapRegulator : public Regulator {
+class TransformerTapRegulator final : public Regulator {
   public:
     using InputType = TransformerTapRegulatorInput;
     using UpdateType = TransformerTapRegulatorUpdate;
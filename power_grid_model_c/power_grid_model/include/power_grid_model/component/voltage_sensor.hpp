@@ -65,7 +65,7 @@ class GenericVoltageSensor : public Sensor {
     virtual VoltageSensorOutput<asymmetric_t> get_asym_output(ComplexValue<asymmetric_t> const& u) const = 0;
 };
 
-template <symmetry_tag sym> class VoltageSensor : public GenericVoltageSensor {
+template <symmetry_tag sym> class VoltageSensor final : public GenericVoltageSensor {
   public:
     static constexpr char const* name = is_symmetric_v<sym> ? "sym_voltage_sensor" : "asym_voltage_sensor";
     using InputType = VoltageSensorInput<sym>;
@@ -8,15 +8,19 @@
 
 #include "common/common.hpp"
 #include "common/exception.hpp"
+#include "common/id_index.hpp"
 
 #include <boost/iterator/iterator_facade.hpp>
 #include <boost/range.hpp>
 
+#include <algorithm>
 #include <array>
 #include <functional>
+#include <iterator>
 #include <memory>
 #include <numeric>
-#include <unordered_map>
+#include <span>
+#include <vector>
 
 namespace power_grid_model {
 
@@ -70,11 +74,14 @@ class Container<RetrievableTypes<GettableTypes...>, StorageableTypes...> {
 
     template <typename T> static constexpr bool is_storageable_v = supported_type_c<T, StorageableTypes...>;
     template <typename T> static constexpr bool is_gettable_v = supported_type_c<T, GettableTypes...>;
+    // a final storageable type is stored in exactly one vector, so it can be accessed without dispatch
+    template <typename T> static constexpr bool is_final_storageable_v = is_storageable_v<T> && std::is_final_v<T>;
 
     // reserve space
     template <supported_type_c<StorageableTypes...> Storageable> void reserve(size_t size) {
         auto& vec = std::get<std::vector<Storageable>>(vectors_);
         vec.reserve(size);
+        id_index_.reserve(id_index_.size() + static_cast<Idx>(size));
     }
 
     // emplace component
@@ -82,7 +89,7 @@ class Container<RetrievableTypes<GettableTypes...>, StorageableTypes...> {
         // template<class... Args> Args&&... args perfect forwarding
         assert(!construction_complete_);
         // throw if id already exists
-        if (map_.contains(id)) {
+        if (id_index_.contains(id)) {
             throw ConflictID{id};
         }
         // find group and position
@@ -91,12 +98,77 @@ class Container<RetrievableTypes<GettableTypes...>, StorageableTypes...> {
         auto const pos = static_cast<Idx>(vec.size());
         // create object
         vec.emplace_back(std::forward<Args>(args)...);
-        // insert idx to map
-        map_[id] = Idx2D{group, pos};
+        // insert idx to the index
+        id_index_.insert(id, Idx2D{group, pos});
+    }
+
+    // append components which are constructed beforehand
+    //    throw if any of the ids already exists
+    template <supported_type_c<StorageableTypes...> Storageable>
+    void append(std::span<ID const> ids, std::vector<Storageable> items) {
+        assert(!construction_complete_);
+        assert(ids.size() == items.size());
+        auto const group = static_cast<Idx>(get_cls_pos_v<Storageable, StorageableTypes...>);
+        auto& vec = std::get<std::vector<Storageable>>(vectors_);
+        auto pos = static_cast<Idx>(vec.size());
+        if (vec.empty()) {
+            vec = std::move(items);
+        } else {
+            vec.insert(vec.end(), std::make_move_iterator(items.begin()), std::make_move_iterator(items.end()));
+        }
+        id_index_.reserve(id_index_.size() + static_cast<Idx>(ids.size()));
+        for (ID const id : ids) {
+            if (!id_index_.insert(id, Idx2D{group, pos})) {
+                throw ConflictID{id};
+            }
+            ++pos;
+        }
+    }
+
+    // remove the components with the ids, the remaining components keep their order
+    //    the storageable types should provide id() to re-index the moved components
+    //    throw if any of the ids does not exist, without changes
+    //    set_construction_complete should be called again afterwards
+    void erase(std::span<ID const> ids) {
+        std::vector<Idx2D> idx(ids.size());
+        id_index_.find(ids, idx);
+        std::array<std::vector<Idx>, num_storageable> removed_pos;
+        for (size_t i = 0; i != ids.size(); ++i) {
+            if (idx[i] == IdIndex::not_found) {
+                throw IDNotFound{ids[i]};
+            }
+            removed_pos[idx[i].group].push_back(idx[i].pos);
+        }
+        for (ID const id : ids) {
+            id_index_.erase(id);
+        }
+        (erase_in_vector<StorageableTypes>(removed_pos[get_type_idx<StorageableTypes>()]), ...);
+    }
+
+    // sizes of the storage vectors, to restore with truncate
+    std::array<Idx, num_storageable> storage_sizes() const {
+        return {static_cast<Idx>(std::get<std::vector<StorageableTypes>>(vectors_).size())...};
+    }
+    // remove the components added after storage_sizes was taken
+    //    set_construction_complete should be called again afterwards
+    void truncate(std::array<Idx, num_storageable> const& sizes) {
+        (truncate_vector<StorageableTypes>(sizes[get_type_idx<StorageableTypes>()]), ...);
+    }
+
+    // allow to add components to a complete container
+    //    set_construction_complete should be called again afterwards
+    void reopen_construction() {
+#ifndef NDEBUG
+        construction_complete_ = false;
+#endif // !NDEBUG
     }
 
     // get item based on Idx2D
     template <supported_type_c<GettableTypes...> Gettable> Gettable& get_item(Idx2D idx_2d) {
+        if constexpr (is_final_storageable_v<Gettable>) {
+            assert(idx_2d.group == get_type_idx<Gettable>());
+            return std::get<std::vector<Gettable>>(vectors_)[idx_2d.pos];
+        }
         constexpr std::array<GetItemFuncPtr<Gettable>, num_storageable> func_arr{
             select_get_item_func_ptr<Gettable, StorageableTypes>::ptr...};
         // selected group should be de derived class of Gettable
@@ -104,6 +176,10 @@ class Container<RetrievableTypes<GettableTypes...>, StorageableTypes...> {
         return (this->*(func_arr[idx_2d.group]))(idx_2d.pos);
     }
     template <supported_type_c<GettableTypes...> Gettable> Gettable const& get_item(Idx2D idx_2d) const {
+        if constexpr (is_final_storageable_v<Gettable>) {
+            assert(idx_2d.group == get_type_idx<Gettable>());
+            return std::get<std::vector<Gettable>>(vectors_)[idx_2d.pos];
+        }
         constexpr std::array<GetItemFuncPtrConst<Gettable>, num_storageable> func_arr{
             select_get_item_func_ptr<Gettable, StorageableTypes>::ptr_const...};
         // selected group should be de derived class of Gettable
@@ -112,11 +188,11 @@ class Container<RetrievableTypes<GettableTypes...>, StorageableTypes...> {
     }
     // get idx by id
     Idx2D get_idx_by_id(ID id) const {
-        auto const found = map_.find(id);
-        if (found == map_.end()) {
+        auto const found = id_index_.find(id);
+        if (found == IdIndex::not_found) {
             throw IDNotFound{id};
         }
-        return found->second;
+        return found;
     }
     template <supported_type_c<GettableTypes...> Gettable> Idx2D get_idx_by_id(ID id) const {
         auto const result = get_idx_by_id(id);
@@ -125,6 +201,29 @@ class Container<RetrievableTypes<GettableTypes...>, StorageableTypes...> {
         }
         return result;
     }
+    // get idx of all ids at once, throw for the first id which is not found or of the wrong type
+    template <supported_type_c<GettableTypes...> Gettable>
+    void get_idx_by_id(std::span<ID const> ids, std::span<Idx2D> result) const {
+        id_index_.find(ids, result);
+        for (size_t i = 0; i != ids.size(); ++i) {
+            if (result[i] == IdIndex::not_found) {
+                throw IDNotFound{ids[i]};
+            }
+            if (!is_base<Gettable>[result[i].group]) {
+                throw IDWrongType{ids[i]};
+            }
+        }
+    }
+    // get idx of all ids at once without throwing, not_found for the ids which are not found or of the wrong type
+    template <supported_type_c<GettableTypes...> Gettable>
+    void find_idx_by_id(std::span<ID const> ids, std::span<Idx2D> result) const {
+        id_index_.find(ids, result);
+        for (auto& idx : result) {
+            if (idx != IdIndex::not_found && !is_base<Gettable>[idx.group]) {
+                idx = IdIndex::not_found;
+            }
+        }
+    }
     // get item based on ID
     template <supported_type_c<GettableTypes...> Gettable> Gettable& get_item(ID id) {
         Idx2D const idx = get_idx_by_id<Gettable>(id);
@@ -144,6 +243,14 @@ class Container<RetrievableTypes<GettableTypes...>, StorageableTypes...> {
         return get_item<Gettable>(get_idx_2d_by_seq<Gettable>(seq));
     }
 
+    // call func(component, seq) for all items of Gettable in sequence order
+    //    the items are visited per storage vector with their storageable type, so that the calls of func on the
+    //    item are resolved at compile time for final types instead of dispatched per item
+    template <supported_type_c<GettableTypes...> Gettable, typename Func> void for_each(Func&& func) const {
+        Idx seq = 0;
+        (for_each_in_vector<Gettable, StorageableTypes>(func, seq), ...);
+    }
+
     // get size
     template <supported_type_c<GettableTypes...> Gettable> Idx size() const {
         assert(construction_complete_);
@@ -161,22 +268,21 @@ class Container<RetrievableTypes<GettableTypes...>, StorageableTypes...> {
     // get sequence idx based on id
     template <supported_type_c<GettableTypes...> Gettable> Idx get_seq(ID id) const {
         assert(construction_complete_);
-        auto const found = map_.find(id);
-        assert(found != map_.end());
-        return get_seq<Gettable>(found->second);
+        auto const found = id_index_.find(id);
+        assert(found != IdIndex::not_found);
+        return get_seq<Gettable>(found);
     }
 
     // get idx_2d based on sequence
+    //    a final storageable type maps the sequence to its own vector, the other types use the table of the type
     template <supported_type_c<GettableTypes...> Gettable> Idx2D get_idx_2d_by_seq(Idx seq) const {
         assert(construction_complete_);
-        assert(seq >= 0);
-        std::array<Idx, num_storageable + 1> const& cum_size = cum_size_[get_cls_pos_v<Gettable, GettableTypes...>];
-        auto const found = std::upper_bound(cum_size.begin(), cum_size.end(), seq);
-        assert(found != cum_size.end());
-        Idx2D res;
-        res.group = static_cast<Idx>(std::distance(cum_size.cbegin(), found) - 1);
-        res.pos = seq - cum_size[res.group];
-        return res;
+        assert(seq >= 0 && seq < size<Gettable>());
+        if constexpr (is_final_storageable_v<Gettable>) {
+            return Idx2D{.group = get_type_idx<Gettable>(), .pos = seq};
+        } else {
+            return idx_2d_by_seq_[get_cls_pos_v<Gettable, GettableTypes...>][seq];
+        }
     }
 
     // get start idx based on two classes
@@ -201,13 +307,17 @@ class Container<RetrievableTypes<GettableTypes...>, StorageableTypes...> {
 #endif // !NDEBUG
         size_ = {size_per_type<GettableTypes>()...};
         cum_size_ = {accumulate_size_per_vector<GettableTypes>()...};
+        idx_2d_by_seq_ = {create_idx_2d_by_seq<GettableTypes>()...};
+        id_index_.compact();
     };
 
   private:
     std::tuple<std::vector<StorageableTypes>...> vectors_;
-    std::unordered_map<ID, Idx2D> map_;
+    IdIndex id_index_;
     std::array<Idx, num_gettable> size_;
     std::array<std::array<Idx, num_storageable + 1>, num_gettable> cum_size_;
+    // idx_2d of each sequence of each gettable type, empty for the final storageable types
+    std::array<std::vector<Idx2D>, num_gettable> idx_2d_by_seq_;
 
 #ifndef NDEBUG
     // set construction_complete is used for debug assertions only
@@ -226,6 +336,51 @@ class Container<RetrievableTypes<GettableTypes...>, StorageableTypes...> {
         return std::get<std::vector<StorageableSubType>>(vectors_)[pos];
     }
 
+    template <class Storageable> void erase_in_vector(std::vector<Idx>& positions) {
+        if (positions.empty()) {
+            return;
+        }
+        std::ranges::sort(positions);
+        auto const group = get_type_idx<Storageable>();
+        auto& vec = std::get<std::vector<Storageable>>(vectors_);
+        auto next_removed = positions.cbegin();
+        Idx new_pos = positions.front();
+        for (Idx pos = positions.front(); pos != static_cast<Idx>(vec.size()); ++pos) {
+            if (next_removed != positions.cend() && *next_removed == pos) {
+                // skip duplicates as well
+                while (next_removed != positions.cend() && *next_removed == pos) {
+                    ++next_removed;
+                }
+                continue;
+            }
+            vec[new_pos] = std::move(vec[pos]);
+            id_index_.assign(vec[new_pos].id(), Idx2D{group, new_pos});
+            ++new_pos;
+        }
+        truncate_vector<Storageable>(new_pos);
+    }
+
+    template <class Storageable> void truncate_vector(Idx size) {
+        auto const group = get_type_idx<Storageable>();
+        auto& vec = std::get<std::vector<Storageable>>(vectors_);
+        while (static_cast<Idx>(vec.size()) > size) {
+            // the id is only registered to this item if it did not conflict with another component
+            if (ID const id = vec.back().id(); id_index_.find(id) == Idx2D{group, static_cast<Idx>(vec.size()) - 1}) {
+                id_index_.erase(id);
+            }
+            vec.pop_back();
+        }
+    }
+
+    template <class Gettable, class Storageable, typename Func> void for_each_in_vector(Func& func, Idx& seq) const {
+        if constexpr (std::derived_from<Storageable, Gettable>) {
+            for (Storageable const& item : std::get<std::vector<Storageable>>(vectors_)) {
+                func(item, seq);
+                ++seq;
+            }
+        }
+    }
+
     // templates to select function pointer
     template <class Storageable> using GetItemFuncPtr = Storageable& (Container::*)(Idx pos);
     template <class Storageable> using GetItemFuncPtrConst = Storageable const& (Container::*)(Idx pos) const;
@@ -269,6 +424,22 @@ class Container<RetrievableTypes<GettableTypes...>, StorageableTypes...> {
         return res;
     }
 
+    template <supported_type_c<GettableTypes...> Gettable> std::vector<Idx2D> create_idx_2d_by_seq() const {
+        if constexpr (is_final_storageable_v<Gettable>) {
+            return {};
+        } else {
+            std::array<Idx, num_storageable> const size_vec = size_per_vector<Gettable>();
+            std::vector<Idx2D> idx_2d_by_seq;
+            idx_2d_by_seq.reserve(static_cast<size_t>(size_per_type<Gettable>()));
+            for (Idx group = 0; group != static_cast<Idx>(num_storageable); ++group) {
+                for (Idx pos = 0; pos != size_vec[group]; ++pos) {
+                    idx_2d_by_seq.push_back(Idx2D{.group = group, .pos = pos});
+                }
+            }
+            return idx_2d_by_seq;
+        }
+    }
+
     // define iterator
     template <supported_type_c<GettableTypes...> Gettable>
     class Iterator : public boost::iterator_facade<Iterator<Gettable>, Gettable, boost::random_access_traversal_tag,
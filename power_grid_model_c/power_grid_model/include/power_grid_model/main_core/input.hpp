@@ -9,21 +9,119 @@
 
 #include "../all_components.hpp"
 
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <span>
+#include <tuple>
 #include <unordered_set>
+#include <utility>
 
 namespace power_grid_model::main_core {
 
 constexpr std::array<Branch3Side, 3> const branch3_sides = {Branch3Side::side_1, Branch3Side::side_2,
                                                             Branch3Side::side_3};
 
+// components which only refer to nodes
+//    they can be constructed independently of each other as soon as all nodes are added
+template <typename Component>
+concept node_referencing_component_c =
+    std::derived_from<Component, Branch> || std::derived_from<Component, Branch3> ||
+    std::derived_from<Component, Appliance> || std::derived_from<Component, GenericVoltageSensor>;
+
+namespace detail {
+// the nodes of which the rated voltages are needed to construct the component
+template <node_referencing_component_c Component>
+constexpr auto referenced_nodes(typename Component::InputType const& input) {
+    if constexpr (std::derived_from<Component, Branch>) {
+        return std::array{input.from_node, input.to_node};
+    } else if constexpr (std::derived_from<Component, Branch3>) {
+        return std::array{input.node_1, input.node_2, input.node_3};
+    } else if constexpr (std::derived_from<Component, Appliance>) {
+        return std::array{input.node};
+    } else {
+        return std::array{input.measured_object};
+    }
+}
+} // namespace detail
+
+// construct the components without adding them to the state
+//    the state is only read, so different component types can be constructed concurrently
+//    the nodes of all components are looked up at once
+template <node_referencing_component_c Component, class ComponentContainer, std::forward_iterator ForwardIterator>
+    requires model_component_state_c<MainModelState, ComponentContainer, Component>
+inline std::vector<Component> construct_components(MainModelState<ComponentContainer> const& state,
+                                                   ForwardIterator begin, ForwardIterator end,
+                                                   double system_frequency) {
+    using InputType = typename Component::InputType;
+    using ReferencedNodes = decltype(detail::referenced_nodes<Component>(std::declval<InputType>()));
+    constexpr size_t n_nodes = std::tuple_size_v<ReferencedNodes>;
+    auto const n_components = static_cast<size_t>(std::distance(begin, end));
+
+    std::vector<ID> node_ids;
+    node_ids.reserve(n_nodes * n_components);
+    for (auto it = begin; it != end; ++it) {
+        std::ranges::copy(detail::referenced_nodes<Component>(*it), std::back_inserter(node_ids));
+    }
+    std::vector<Idx2D> node_idx(node_ids.size());
+    get_component_idx_by_id<Node>(state, std::span<ID const>{node_ids}, std::span<Idx2D>{node_idx});
+    auto const u_rated = [&state, &node_idx](size_t node) {
+        return get_component<Node>(state, node_idx[node]).u_rated();
+    };
+
+    std::vector<Component> components;
+    components.reserve(n_components);
+    size_t node = 0;
+    for (auto it = begin; it != end; ++it, node += n_nodes) {
+        auto const& input = *it;
+        if constexpr (std::same_as<Component, Line>) {
+            // set system frequency for line
+            components.emplace_back(input, system_frequency, u_rated(node), u_rated(node + 1));
+        } else if constexpr (std::derived_from<Component, Branch>) {
+            components.emplace_back(input, u_rated(node), u_rated(node + 1));
+        } else if constexpr (std::derived_from<Component, Branch3>) {
+            components.emplace_back(input, u_rated(node), u_rated(node + 1), u_rated(node + 2));
+        } else {
+            components.emplace_back(input, u_rated(node));
+        }
+    }
+    return components;
+}
+
 // template to construct components
 // using forward interators
 // different selection based on component type
-template <std::derived_from<Base> Component, class ComponentContainer, std::forward_iterator ForwardIterator>
+//    the components are added one by one, so that the first invalid input raises the error
+template <node_referencing_component_c Component, class ComponentContainer, std::forward_iterator ForwardIterator>
     requires model_component_state_c<MainModelState, ComponentContainer, Component>
 inline void add_component(MainModelState<ComponentContainer>& state, ForwardIterator begin, ForwardIterator end,
                           double system_frequency) {
     reserve_component<Component>(state, std::distance(begin, end));
+    for (auto it = begin; it != end; ++it) {
+        auto const& input = *it;
+        ID const id = input.id;
+        auto const u = std::apply(
+            [&state](auto... node) { return std::array{get_component<Node>(state, node).u_rated()...}; },
+            detail::referenced_nodes<Component>(input));
+        if constexpr (std::same_as<Component, Line>) {
+            // set system frequency for line
+            emplace_component<Component>(state, id, input, system_frequency, u[0], u[1]);
+        } else if constexpr (std::derived_from<Component, Branch>) {
+            emplace_component<Component>(state, id, input, u[0], u[1]);
+        } else if constexpr (std::derived_from<Component, Branch3>) {
+            emplace_component<Component>(state, id, input, u[0], u[1], u[2]);
+        } else {
+            emplace_component<Component>(state, id, input, u[0]);
+        }
+    }
+}
+
+template <std::derived_from<Base> Component, class ComponentContainer, std::forward_iterator ForwardIterator>
+    requires model_component_state_c<MainModelState, ComponentContainer, Component> &&
+             (!node_referencing_component_c<Component>)
+inline void add_component(MainModelState<ComponentContainer>& state, ForwardIterator begin, ForwardIterator end,
+                          double /* system_frequency */) {
+    reserve_component<Component>(state, std::distance(begin, end));
     // do sanity check on the transformer tap regulator
     std::vector<Idx2D> regulated_objects;
     // loop to add component
@@ -33,26 +131,6 @@ inline void add_component(MainModelState<ComponentContainer>& state, ForwardIter
         // construct based on type of component
         if constexpr (std::derived_from<Component, Node>) {
             emplace_component<Component>(state, id, input);
-        } else if constexpr (std::derived_from<Component, Branch>) {
-            double const u1 = get_component<Node>(state, input.from_node).u_rated();
-            double const u2 = get_component<Node>(state, input.to_node).u_rated();
-            // set system frequency for line
-            if constexpr (std::same_as<Component, Line>) {
-                emplace_component<Component>(state, id, input, system_frequency, u1, u2);
-            } else {
-                emplace_component<Component>(state, id, input, u1, u2);
-            }
-        } else if constexpr (std::derived_from<Component, Branch3>) {
-            double const u1 = get_component<Node>(state, input.node_1).u_rated();
-            double const u2 = get_component<Node>(state, input.node_2).u_rated();
-            double const u3 = get_component<Node>(state, input.node_3).u_rated();
-            emplace_component<Component>(state, id, input, u1, u2, u3);
-        } else if constexpr (std::derived_from<Component, Appliance>) {
-            double const u = get_component<Node>(state, input.node).u_rated();
-            emplace_component<Component>(state, id, input, u);
-        } else if constexpr (std::derived_from<Component, GenericVoltageSensor>) {
-            double const u = get_component<Node>(state, input.measured_object).u_rated();
-            emplace_component<Component>(state, id, input, u);
         } else if constexpr (std::derived_from<Component, GenericPowerSensor>) {
             // it is not allowed to place a sensor at a link
             if (get_component_idx_by_id(state, input.measured_object).group == get_component_type_index<Link>(state)) {
@@ -172,4 +250,17 @@ inline void add_component(MainModelState<ComponentContainer>& state, ForwardIter
     }
 }
 
+// check that each regulated object of the model has at most one regulator
+//    add_component only checks the regulators which are added together
+template <class ComponentContainer>
+    requires main_model_state_c<MainModelState<ComponentContainer>>
+inline void check_unique_regulated_objects(MainModelState<ComponentContainer> const& state) {
+    std::unordered_set<ID> regulated_objects;
+    for_each_component<Regulator>(state, [&regulated_objects](Regulator const& regulator, Idx /* seq */) {
+        if (!regulated_objects.insert(regulator.regulated_object()).second) {
+            throw DuplicativelyRegulatedObject{};
+        }
+    });
+}
+
 } // namespace power_grid_model::main_core
@@ -84,8 +84,12 @@ template <typename Component, typename IndexType, class ComponentContainer, std:
              std::convertible_to<IndexType,
                                  decltype(*comp_base_sequence_cbegin<Component>(MainModelState<ComponentContainer>{}))>
 constexpr ResIt produce_output(MainModelState<ComponentContainer> const& state, ResIt res_it, ResFunc&& func) {
-    return std::transform(get_component_citer<Component>(state).begin(), get_component_citer<Component>(state).end(),
-                          comp_base_sequence_cbegin<Component>(state), res_it, func);
+    auto const index_begin = comp_base_sequence_cbegin<Component>(state);
+    for_each_component<Component>(state, [&res_it, &func, &index_begin](auto const& component, Idx seq) {
+        *res_it = func(component, index_begin[seq]);
+        ++res_it;
+    });
+    return res_it;
 }
 
 } // namespace detail
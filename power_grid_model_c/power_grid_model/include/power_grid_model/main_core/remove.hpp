@@ -0,0 +1,55 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "state.hpp"
+#include "state_queries.hpp"
+
+#include "../all_components.hpp"
+
+#include <span>
+#include <unordered_set>
+
+namespace power_grid_model::main_core {
+
+// check that the components can be removed from the model
+//    a component cannot be removed as long as a remaining component refers to it, e.g. a node with a line
+template <class ComponentContainer>
+    requires main_model_state_c<MainModelState<ComponentContainer>>
+inline void check_removable_components(MainModelState<ComponentContainer> const& state, std::span<ID const> ids) {
+    std::unordered_set<ID> const removed(ids.begin(), ids.end());
+    auto const check_reference = [&removed](Base const& component, ID referenced_id) {
+        if (removed.contains(referenced_id) && !removed.contains(component.id())) {
+            throw ReferencedComponentRemoval{referenced_id, component.id()};
+        }
+    };
+
+    for_each_component<Branch>(state, [&check_reference](Branch const& branch, Idx /* seq */) {
+        check_reference(branch, branch.from_node());
+        check_reference(branch, branch.to_node());
+    });
+    for_each_component<Branch3>(state, [&check_reference](Branch3 const& branch3, Idx /* seq */) {
+        check_reference(branch3, branch3.node_1());
+        check_reference(branch3, branch3.node_2());
+        check_reference(branch3, branch3.node_3());
+    });
+    for_each_component<Appliance>(state, [&check_reference](Appliance const& appliance, Idx /* seq */) {
+        check_reference(appliance, appliance.node());
+    });
+    for_each_component<GenericVoltageSensor>(state, [&check_reference](Sensor const& sensor, Idx /* seq */) {
+        check_reference(sensor, sensor.measured_object());
+    });
+    for_each_component<GenericPowerSensor>(state, [&check_reference](Sensor const& sensor, Idx /* seq */) {
+        check_reference(sensor, sensor.measured_object());
+    });
+    for_each_component<Regulator>(state, [&check_reference](Regulator const& regulator, Idx /* seq */) {
+        check_reference(regulator, regulator.regulated_object());
+    });
+    for_each_component<Fault>(state, [&check_reference](Fault const& fault, Idx /* seq */) {
+        check_reference(fault, fault.get_fault_object());
+    });
+}
+
+} // namespace power_grid_model::main_core
@@ -8,6 +8,10 @@
 
 #include "../all_components.hpp"
 
+#include <algorithm>
+#include <span>
+#include <vector>
+
 namespace power_grid_model::main_core {
 template <typename ComponentType, class ComponentContainer>
     requires model_component_state_c<MainModelState, ComponentContainer, ComponentType>
@@ -33,6 +37,20 @@ inline Idx2D get_component_idx_by_id(MainModelState<ComponentContainer> const& s
     return state.components.template get_idx_by_id<ComponentType>(id);
 }
 
+template <typename ComponentType, class ComponentContainer>
+    requires model_component_state_c<MainModelState, ComponentContainer, ComponentType>
+inline void get_component_idx_by_id(MainModelState<ComponentContainer> const& state, std::span<ID const> ids,
+                                    std::span<Idx2D> result) {
+    state.components.template get_idx_by_id<ComponentType>(ids, result);
+}
+
+template <typename ComponentType, class ComponentContainer>
+    requires model_component_state_c<MainModelState, ComponentContainer, ComponentType>
+inline void find_component_idx_by_id(MainModelState<ComponentContainer> const& state, std::span<ID const> ids,
+                                     std::span<Idx2D> result) {
+    state.components.template find_idx_by_id<ComponentType>(ids, result);
+}
+
 template <typename ComponentType, class ComponentContainer>
     requires model_component_state_c<MainModelState, ComponentContainer, ComponentType>
 inline Idx get_component_sequence(MainModelState<ComponentContainer> const& state, auto const& id_or_index) {
@@ -76,6 +94,14 @@ constexpr auto emplace_component(MainModelState<ComponentContainer>& state, ID i
     return state.components.template emplace<ComponentType>(id, std::forward<Args>(args)...);
 }
 
+template <std::derived_from<Base> ComponentType, class ComponentContainer>
+    requires model_component_state_c<MainModelState, ComponentContainer, ComponentType>
+inline void append_component(MainModelState<ComponentContainer>& state, std::vector<ComponentType> components) {
+    std::vector<ID> ids(components.size());
+    std::ranges::transform(components, ids.begin(), [](ComponentType const& component) { return component.id(); });
+    state.components.template append<ComponentType>(ids, std::move(components));
+}
+
 template <typename ComponentType, class ComponentContainer, typename... Args>
     requires model_component_state_c<MainModelState, ComponentContainer, ComponentType>
 constexpr void reserve_component(MainModelState<ComponentContainer>& state, std::integral auto size) {
@@ -88,6 +114,13 @@ constexpr auto get_component_citer(MainModelState<ComponentContainer> const& sta
     return state.components.template citer<ComponentType>();
 }
 
+// call func(component, sequence) for all components of the type, with the component as its storage type
+template <typename ComponentType, class ComponentContainer, typename Func>
+    requires model_component_state_c<MainModelState, ComponentContainer, ComponentType>
+constexpr void for_each_component(MainModelState<ComponentContainer> const& state, Func&& func) {
+    state.components.template for_each<ComponentType>(std::forward<Func>(func));
+}
+
 template <std::derived_from<Branch> ComponentType, class ComponentContainer>
     requires model_component_state_c<MainModelState, ComponentContainer, ComponentType>
 constexpr auto get_topology_index(MainModelState<ComponentContainer> const& state, auto const& id_or_index) {
@@ -27,25 +27,27 @@ inline void iterate_component_sequence(Func&& func, ForwardIterator begin, Forwa
 }
 } // namespace detail
 
-template <component_c Component, class ComponentContainer, std::forward_iterator ForwardIterator,
-          std::output_iterator<Idx2D> OutputIterator>
+// the IDs are resolved in bulk, which is faster than one by one for large updates
+template <component_c Component, class ComponentContainer, std::forward_iterator ForwardIterator>
     requires model_component_state_c<MainModelState, ComponentContainer, Component>
-inline void get_component_sequence(MainModelState<ComponentContainer> const& state, ForwardIterator begin,
-                                   ForwardIterator end, OutputIterator destination) {
+inline std::vector<Idx2D> get_component_sequence(MainModelState<ComponentContainer> const& state, ForwardIterator begin,
+                                                 ForwardIterator end) {
     using UpdateType = typename Component::UpdateType;
 
-    std::transform(begin, end, destination,
-                   [&state](UpdateType const& update) { return get_component_idx_by_id<Component>(state, update.id); });
+    std::vector<ID> ids;
+    ids.reserve(std::distance(begin, end));
+    std::transform(begin, end, std::back_inserter(ids), [](UpdateType const& update) { return update.id; });
+    std::vector<Idx2D> result(ids.size());
+    get_component_idx_by_id<Component>(state, std::span<ID const>{ids}, std::span<Idx2D>{result});
+    return result;
 }
 
-template <component_c Component, class ComponentContainer, std::forward_iterator ForwardIterator>
+template <component_c Component, class ComponentContainer, std::forward_iterator ForwardIterator,
+          std::output_iterator<Idx2D> OutputIterator>
     requires model_component_state_c<MainModelState, ComponentContainer, Component>
-inline std::vector<Idx2D> get_component_sequence(MainModelState<ComponentContainer> const& state, ForwardIterator begin,
-                                                 ForwardIterator end) {
-    std::vector<Idx2D> result;
-    result.reserve(std::distance(begin, end));
-    get_component_sequence<Component>(state, begin, end, std::back_inserter(result));
-    return result;
+inline void get_component_sequence(MainModelState<ComponentContainer> const& state, ForwardIterator begin,
+                                   ForwardIterator end, OutputIterator destination) {
+    std::ranges::copy(get_component_sequence<Component>(state, begin, end), destination);
 }
 
 // template to update components
@@ -19,12 +19,16 @@
 
 // component include
 #include "all_components.hpp"
+#include "auxiliary/batch_aggregation.hpp"
+#include "auxiliary/batch_reduction.hpp"
+#include "auxiliary/batch_violation.hpp"
 #include "auxiliary/dataset.hpp"
 #include "auxiliary/input.hpp"
 #include "auxiliary/output.hpp"
 
 // math model include
 #include "math_solver/math_solver.hpp"
+#include "math_solver/observability.hpp"
 
 #include "optimizer/optimizer.hpp"
 
@@ -33,13 +37,19 @@
 #include "main_core/input.hpp"
 #include "main_core/math_state.hpp"
 #include "main_core/output.hpp"
+#include "main_core/remove.hpp"
 #include "main_core/topology.hpp"
 #include "main_core/update.hpp"
 
 // stl library
+#include <exception>
+#include <functional>
+#include <future>
 #include <memory>
+#include <optional>
 #include <span>
 #include <thread>
+#include <utility>
 
 namespace power_grid_model {
 
@@ -83,6 +93,17 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
 
     using SequenceIdx = std::array<std::vector<Idx2D>, n_types>;
 
+    // sequence idx of all scenarios of a dependent update batch, resolved at once before the calculation
+    //    the sequence idx of scenario begin_scenario + i of a component type is
+    //    sequence_idx[type][indptr[type][i] : indptr[type][i + 1]]
+    //    a scenario is not resolved if any of its ids is not found or of the wrong type
+    struct BatchSequenceIdx {
+        Idx begin_scenario{};
+        SequenceIdx sequence_idx{};
+        std::array<IdxVector, n_types> indptr{};
+        std::vector<IntS> is_resolved{};
+    };
+
     using OwnedUpdateDataset = std::tuple<std::vector<typename ComponentType::UpdateType>...>;
 
     static constexpr Idx ignore_output{-1};
@@ -106,6 +127,9 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
         CalculationMethod calculation_method{CalculationMethod::default_method};
         OptimizerType optimizer_type{OptimizerType::no_optimization};
         OptimizerStrategy optimizer_strategy{OptimizerStrategy::any};
+        // start the optimization from the optimized state of the previous calculation of the same model
+        //    in a batch, this is the previous scenario calculated by the same thread
+        bool optimizer_warm_start{false};
 
         double err_tol{1e-8};
         Idx max_iter{20};
@@ -114,14 +138,41 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
         ShortCircuitVoltageScaling short_circuit_voltage_scaling{ShortCircuitVoltageScaling::maximum};
     };
 
+    // streaming batch output
+    //    the scenarios are calculated chunk by chunk into a ring of fixed-size output chunks
+    //    every finished chunk is handed over to consume_chunk while the next chunk is being calculated
+    //    consume_chunk is called from a worker thread, but never concurrently with itself
+    struct BatchStream {
+        using ConsumeChunkFn =
+            std::function<void(Idx chunk_start, Idx chunk_size, MutableDataset const& result_chunk)>;
+
+        std::span<MutableDataset const> result_chunks;
+        ConsumeChunkFn consume_chunk;
+    };
+
+    // incremental batch update input
+    //    get_chunk should return a batch update dataset containing exactly chunk_size scenarios
+    //    the returned dataset only needs to stay valid until the next call of get_chunk
+    struct UpdateStream {
+        using GetChunkFn = std::function<ConstDataset(Idx chunk_start, Idx chunk_size)>;
+
+        Idx n_scenarios;
+        GetChunkFn get_chunk;
+    };
+
     // constructor with data
-    explicit MainModelImpl(double system_frequency, ConstDataset const& input_data, Idx pos = 0)
+    //    threading has the same meaning as for batch calculations, the threads are used per component type
+    //    the timing of the construction is reported in the calculation info until the first calculation
+    explicit MainModelImpl(double system_frequency, ConstDataset const& input_data, Idx pos = 0,
+                           Idx threading = Options::sequential)
         : system_frequency_{system_frequency}, meta_data_{&input_data.meta_data()} {
         assert(input_data.get_description().dataset->name == std::string_view("input"));
-        auto const add_func = [this, pos, &input_data]<typename CT>() {
-            this->add_component<CT>(input_data.get_buffer_span<meta_data::input_getter_s, CT>(pos));
-        };
-        run_functor_with_all_types_return_void(add_func);
+        Timer const t_construct(calculation_info_, 4000, "Construct model");
+        {
+            Timer const t_add(calculation_info_, 4100, "Add components");
+            add_components_(input_data, pos, threading);
+        }
+        Timer const t_complete(calculation_info_, 4200, "Complete construction");
         set_construction_complete();
     }
 
@@ -247,6 +298,37 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
         cached_state_changes_ = {};
     }
 
+    // structural edits after construction
+    //    the components are not reconstructed, the topology is rebuilt at the next calculation
+    //    if an error occurs, the model is left unchanged
+
+    // add the components of an input dataset, the ids should not exist in the model yet
+    void add_components(ConstDataset const& input_data, Idx pos = 0) {
+        assert(construction_complete_);
+        assert(input_data.get_description().dataset->name == std::string_view("input"));
+        auto const storage_sizes = state_.components.storage_sizes();
+        reopen_construction();
+        try {
+            add_components_(input_data, pos, Options::sequential);
+            main_core::check_unique_regulated_objects(state_);
+        } catch (...) {
+            // the existing components are unchanged, so the topology and the solvers are kept
+            state_.components.truncate(storage_sizes);
+            restore_construction();
+            throw;
+        }
+        complete_structural_edit();
+    }
+
+    // remove the components with the ids, a component cannot be removed while another component refers to it
+    void remove_components(std::span<ID const> ids) {
+        assert(construction_complete_);
+        main_core::check_removable_components(state_, ids);
+        state_.components.erase(ids);
+        reopen_construction();
+        complete_structural_edit();
+    }
+
     // set complete construction
     // initialize internal arrays
     void set_construction_complete() {
@@ -319,7 +401,157 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
         return get_sequence_idx_map(update_data, 0);
     }
 
+    // get sequence idx map of the scenarios begin_scenario, ..., begin_scenario + n_scenarios - 1 at once
+    //    the ids of all scenarios are gathered per component type and looked up in bulk,
+    //    the scenarios are divided over the threads in the same way as in a batch calculation
+    //    the ids which cannot be resolved are not reported here, see get_sequence_idx_map below
+    BatchSequenceIdx get_batch_sequence_idx_map(ConstDataset const& update_data, Idx begin_scenario, Idx n_scenarios,
+                                                Idx threading = -1) const {
+        BatchSequenceIdx result{};
+        result.begin_scenario = begin_scenario;
+        result.is_resolved.assign(n_scenarios, IntS{1});
+        run_functor_with_all_types_return_void([&result, &update_data, begin_scenario, n_scenarios]<typename CT>() {
+            auto& indptr = result.indptr[index_of_component<CT>];
+            indptr.resize(n_scenarios + 1);
+            indptr[0] = 0;
+            for (Idx scenario = 0; scenario != n_scenarios; ++scenario) {
+                auto const buffer_span =
+                    update_data.get_buffer_span<meta_data::update_getter_s, CT>(begin_scenario + scenario);
+                indptr[scenario + 1] = indptr[scenario] + narrow_cast<Idx>(buffer_span.size());
+            }
+            result.sequence_idx[index_of_component<CT>].resize(indptr.back());
+        });
+
+        batch_dispatch(
+            [&state = this->state_, &result, &update_data](Idx start, Idx stride, Idx n_scenarios_in_batch) {
+                std::vector<ID> ids;
+                for (Idx scenario = start; scenario < n_scenarios_in_batch; scenario += stride) {
+                    run_functor_with_all_types_return_void([&state, &result, &update_data, &ids,
+                                                            scenario]<typename CT>() {
+                        auto const buffer_span = update_data.get_buffer_span<meta_data::update_getter_s, CT>(
+                            result.begin_scenario + scenario);
+                        if (buffer_span.empty()) {
+                            return;
+                        }
+                        ids.resize(buffer_span.size());
+                        std::ranges::transform(buffer_span, ids.begin(),
+                                               [](typename CT::UpdateType const& update) { return update.id; });
+                        std::span<Idx2D> const scenario_sequence{
+                            std::next(result.sequence_idx[index_of_component<CT>].begin(),
+                                      result.indptr[index_of_component<CT>][scenario]),
+                            buffer_span.size()};
+                        main_core::find_component_idx_by_id<CT>(state, std::span<ID const>{ids}, scenario_sequence);
+                        if (std::ranges::find(scenario_sequence, IdIndex::not_found) != scenario_sequence.end()) {
+                            result.is_resolved[scenario] = IntS{0};
+                        }
+                    });
+                }
+            },
+            n_scenarios, threading);
+        return result;
+    }
+
+    // get sequence idx map of a batch scenario from the sequence idx map of the entire batch
+    //    the storage of scenario_sequence is reused
+    //    a scenario which is not resolved is looked up again, to throw the error of the first offending id
+    void get_sequence_idx_map(BatchSequenceIdx const& batch_sequence, ConstDataset const& update_data,
+                              Idx scenario_idx, SequenceIdx& scenario_sequence) const {
+        Idx const scenario = scenario_idx - batch_sequence.begin_scenario;
+        assert(0 <= scenario && scenario < std::ssize(batch_sequence.is_resolved));
+        if (batch_sequence.is_resolved[scenario] == 0) {
+            scenario_sequence = get_sequence_idx_map(update_data, scenario_idx);
+            return;
+        }
+        for (size_t type = 0; type != n_types; ++type) {
+            auto const& indptr = batch_sequence.indptr[type];
+            auto const begin = batch_sequence.sequence_idx[type].begin();
+            scenario_sequence[type].assign(std::next(begin, indptr[scenario]), std::next(begin, indptr[scenario + 1]));
+        }
+    }
+
   private:
+    // the nodes are added first, because all other components refer to them
+    // the components which only refer to nodes are then constructed concurrently per type,
+    //    and added in the order of the types
+    //    a type of which the construction failed is added again one by one instead, so that the error is the same
+    //    as for a sequential construction, e.g. a conflicting id before an invalid parameter of the same type
+    void add_components_(ConstDataset const& input_data, Idx pos, Idx threading) {
+        add_component<Node>(input_data.get_buffer_span<meta_data::input_getter_s, Node>(pos));
+
+        std::tuple<std::vector<ComponentType>...> constructed;
+        std::array<std::exception_ptr, n_types> exceptions{};
+        batch_dispatch(
+            [this, pos, &input_data, &constructed, &exceptions](Idx start, Idx stride, Idx n_component_types) {
+                for (Idx type_idx = start; type_idx < n_component_types; type_idx += stride) {
+                    run_functor_with_all_types_return_void([this, pos, &input_data, &constructed, &exceptions,
+                                                            type_idx]<typename CT>() {
+                        if constexpr (main_core::node_referencing_component_c<CT>) {
+                            if (type_idx != static_cast<Idx>(index_of_component<CT>)) {
+                                return;
+                            }
+                            try {
+                                auto const input = input_data.get_buffer_span<meta_data::input_getter_s, CT>(pos);
+                                std::get<std::vector<CT>>(constructed) = main_core::construct_components<CT>(
+                                    state_, input.begin(), input.end(), system_frequency_);
+                            } catch (...) {
+                                exceptions[type_idx] = std::current_exception();
+                            }
+                        }
+                    });
+                }
+            },
+            static_cast<Idx>(n_types), threading);
+
+        run_functor_with_all_types_return_void([this, pos, &input_data, &constructed, &exceptions]<typename CT>() {
+            if constexpr (main_core::node_referencing_component_c<CT>) {
+                if (exceptions[index_of_component<CT>] != nullptr) {
+                    add_component<CT>(input_data.get_buffer_span<meta_data::input_getter_s, CT>(pos));
+                } else {
+                    main_core::append_component<CT>(state_, std::move(std::get<std::vector<CT>>(constructed)));
+                }
+            } else if constexpr (!std::same_as<CT, Node>) {
+                add_component<CT>(input_data.get_buffer_span<meta_data::input_getter_s, CT>(pos));
+            }
+        });
+    }
+
+    void reopen_construction() {
+#ifndef NDEBUG
+        construction_complete_ = false;
+#endif // !NDEBUG
+        state_.components.reopen_construction();
+    }
+
+    // restore the construction of a failed structural edit, after the added components are removed again
+    void restore_construction() {
+#ifndef NDEBUG
+        construction_complete_ = true;
+#endif // !NDEBUG
+        state_.components.set_construction_complete();
+    }
+
+    void complete_structural_edit() {
+        set_construction_complete();
+        // the islands which are not affected by the edit are reused when the topology is rebuilt, see reuse_islands
+        if (!state_.math_topology.empty()) {
+            previous_islands_ =
+                PreviousIslands{.math_topology = std::move(state_.math_topology), .math_state = std::move(math_state_)};
+        }
+        reset_solvers();
+        // the positions of the components may have changed
+        std::ranges::for_each(parameter_changed_components_, [](auto& comps) { comps.clear(); });
+        regulator_order_cache_ = {};
+    }
+
+    // update the state with the components changed by the optimizer
+    void update_optimized_component(ConstDataset const& update_data) {
+        update_component<permanent_update_t>(update_data);
+    }
+    // the optimizer already knows the position of the components, so the ID lookup is skipped
+    template <class CompType> void update_optimized_component(optimizer::ComponentUpdate<CompType> const& update_data) {
+        update_component<CompType, permanent_update_t>(update_data.updates, update_data.sequence_idx);
+    }
+
     void update_state(const UpdateChange& changes) {
         // if topology changed, everything is not up to date
         // if only param changed, set param to not up to date
@@ -328,77 +560,155 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
         is_asym_parameter_up_to_date_ = is_asym_parameter_up_to_date_ && !changes.topo && !changes.param;
     }
 
+    // the math models of the islands are independent, so they can be solved concurrently
+    //    threading has the same meaning as for batch calculations
+    //    each island reports to its own calculation info, which are merged afterwards
     template <solver_output_type SolverOutputType, typename MathSolverType, typename YBus, typename InputType,
               typename PrepareInputFn, typename SolveFn>
         requires std::invocable<std::remove_cvref_t<PrepareInputFn>, Idx /*n_math_solvers*/> &&
-                 std::invocable<std::remove_cvref_t<SolveFn>, MathSolverType&, YBus const&, InputType const&> &&
+                 std::invocable<std::remove_cvref_t<SolveFn>, MathSolverType&, YBus const&, InputType const&,
+                                CalculationInfo&> &&
                  std::same_as<std::invoke_result_t<PrepareInputFn, Idx /*n_math_solvers*/>, std::vector<InputType>> &&
-                 std::same_as<std::invoke_result_t<SolveFn, MathSolverType&, YBus const&, InputType const&>,
-                              SolverOutputType>
-    std::vector<SolverOutputType> calculate_(PrepareInputFn&& prepare_input, SolveFn&& solve) {
+                 std::same_as<
+                     std::invoke_result_t<SolveFn, MathSolverType&, YBus const&, InputType const&, CalculationInfo&>,
+                     SolverOutputType>
+    std::vector<SolverOutputType> calculate_(PrepareInputFn&& prepare_input, SolveFn&& solve,
+                                             Idx threading = Options::sequential) {
         using sym = typename SolverOutputType::sym;
 
         assert(construction_complete_);
         calculation_info_ = CalculationInfo{};
         // prepare
+        //    the input is prepared before the Y bus and the solvers, so that an invalid input fails early
         auto const& input = [this, &prepare_input] {
             Timer const timer(calculation_info_, 2100, "Prepare");
+            if (!is_topology_up_to_date_) {
+                rebuild_topology();
+            }
+            auto result = prepare_input(n_math_solvers_);
             prepare_solvers<sym>();
             assert(is_topology_up_to_date_ && is_parameter_up_to_date<sym>());
-            return prepare_input(n_math_solvers_);
+            return result;
         }();
         // calculate
-        return [this, &input, &solve] {
+        return [this, &input, &solve, threading] {
             Timer const timer(calculation_info_, 2200, "Math Calculation");
             auto& solvers = get_solvers<sym>();
             auto& y_bus_vec = get_y_bus<sym>();
             std::vector<SolverOutputType> solver_output;
-            solver_output.reserve(n_math_solvers_);
-            for (Idx i = 0; i != n_math_solvers_; ++i) {
-                solver_output.emplace_back(solve(solvers[i], y_bus_vec[i], input[i]));
+            if (batch_thread_count(threading, n_math_solvers_) == 1) {
+                solver_output.reserve(n_math_solvers_);
+                for (Idx i = 0; i != n_math_solvers_; ++i) {
+                    solver_output.emplace_back(solve(solvers[i], y_bus_vec[i], input[i], calculation_info_));
+                }
+                return solver_output;
+            }
+
+            solver_output.resize(n_math_solvers_);
+            std::vector<CalculationInfo> infos(n_math_solvers_);
+            std::vector<std::exception_ptr> exceptions(n_math_solvers_);
+            batch_dispatch(
+                [&](Idx start, Idx stride, Idx n_islands) {
+                    for (Idx i = start; i < n_islands; i += stride) {
+                        try {
+                            solver_output[i] = solve(solvers[i], y_bus_vec[i], input[i], infos[i]);
+                        } catch (...) {
+                            exceptions[i] = std::current_exception();
+                        }
+                    }
+                },
+                n_math_solvers_, threading);
+
+            // report the error of the first failing island, like in a sequential calculation
+            if (auto const failed = std::ranges::find_if(exceptions, [](auto const& e) { return e != nullptr; });
+                failed != exceptions.end()) {
+                std::rethrow_exception(*failed);
             }
+            infos.push_back(std::move(calculation_info_));
+            calculation_info_ = main_core::merge_calculation_info(infos);
             return solver_output;
         }();
     }
 
-    template <symmetry_tag sym> auto calculate_power_flow_(double err_tol, Idx max_iter) {
-        return [this, err_tol, max_iter](MainModelState const& state,
-                                         CalculationMethod calculation_method) -> std::vector<SolverOutput<sym>> {
+    // the power flow can be warm started with the result of a previous calculation of the same topology
+    template <symmetry_tag sym>
+    auto calculate_power_flow_(double err_tol, Idx max_iter, Idx threading = Options::sequential) {
+        return [this, err_tol, max_iter, threading](MainModelState const& state, CalculationMethod calculation_method,
+                                                    std::vector<SolverOutput<sym>> const& initial_solution = {})
+                   -> std::vector<SolverOutput<sym>> {
             return calculate_<SolverOutput<sym>, MathSolver<sym>, YBus<sym>, PowerFlowInput<sym>>(
-                [&state](Idx n_math_solvers) { return prepare_power_flow_input<sym>(state, n_math_solvers); },
-                [this, err_tol, max_iter, calculation_method](MathSolver<sym>& solver, YBus<sym> const& y_bus,
-                                                              PowerFlowInput<sym> const& input) {
-                    return solver.run_power_flow(input, err_tol, max_iter, calculation_info_, calculation_method,
-                                                 y_bus);
-                });
+                [&state, &initial_solution](Idx n_math_solvers) {
+                    auto input = prepare_power_flow_input<sym>(state, n_math_solvers);
+                    if (static_cast<Idx>(initial_solution.size()) == n_math_solvers) {
+                        for (Idx i = 0; i != n_math_solvers; ++i) {
+                            if (static_cast<Idx>(initial_solution[i].u.size()) == state.math_topology[i]->n_bus()) {
+                                input[i].initial_u = initial_solution[i].u;
+                            }
+                        }
+                    }
+                    return input;
+                },
+                [err_tol, max_iter, calculation_method](MathSolver<sym>& solver, YBus<sym> const& y_bus,
+                                                        PowerFlowInput<sym> const& input, CalculationInfo& info) {
+                    return solver.run_power_flow(input, err_tol, max_iter, info, calculation_method, y_bus);
+                },
+                threading);
         };
     }
 
     template <symmetry_tag sym> auto calculate_state_estimation_(double err_tol, Idx max_iter) {
         return [this, err_tol, max_iter](MainModelState const& state,
                                          CalculationMethod calculation_method) -> std::vector<SolverOutput<sym>> {
+            // an invalid method is reported before the observability
+            using enum CalculationMethod;
+            if (calculation_method != default_method && calculation_method != iterative_linear &&
+                calculation_method != newton_raphson) {
+                throw InvalidCalculationMethod{};
+            }
             return calculate_<SolverOutput<sym>, MathSolver<sym>, YBus<sym>, StateEstimationInput<sym>>(
-                [&state](Idx n_math_solvers) { return prepare_state_estimation_input<sym>(state, n_math_solvers); },
-                [this, err_tol, max_iter, calculation_method](MathSolver<sym>& solver, YBus<sym> const& y_bus,
-                                                              StateEstimationInput<sym> const& input) {
-                    return solver.run_state_estimation(input, err_tol, max_iter, calculation_info_, calculation_method,
-                                                       y_bus);
+                [this, &state](Idx n_math_solvers) {
+                    auto input = prepare_state_estimation_input<sym>(state, n_math_solvers);
+                    // an unobservable island fails the whole calculation, so check all islands before the Y bus
+                    //    and the solvers are prepared
+                    //    the math solvers keep the measured values of the check, so they are not refreshed twice
+                    check_observability_<sym>(input);
+                    return input;
+                },
+                [err_tol, max_iter, calculation_method](MathSolver<sym>& solver, YBus<sym> const& y_bus,
+                                                        StateEstimationInput<sym> const& input,
+                                                        CalculationInfo& info) {
+                    return solver.run_state_estimation(input, err_tol, max_iter, info, calculation_method, y_bus,
+                                                       true);
                 });
         };
     }
 
-    template <symmetry_tag sym> auto calculate_short_circuit_(ShortCircuitVoltageScaling voltage_scaling) {
-        return [this,
-                voltage_scaling](MainModelState const& /*state*/,
-                                 CalculationMethod calculation_method) -> std::vector<ShortCircuitSolverOutput<sym>> {
+    // the check only needs the topology, so the math solvers are created without preparing the Y bus
+    template <symmetry_tag sym> void check_observability_(std::vector<StateEstimationInput<sym>> const& input) {
+        create_solvers<sym>();
+        auto& solvers = get_solvers<sym>();
+        for (Idx i = 0; i != n_math_solvers_; ++i) {
+            solvers[i].check_observability(input[i], calculation_info_);
+        }
+    }
+
+    // in a fault sweep, each fault is calculated independently instead of all faults at once
+    template <symmetry_tag sym>
+    auto calculate_short_circuit_(ShortCircuitVoltageScaling voltage_scaling, bool fault_sweep = false) {
+        return [this, voltage_scaling,
+                fault_sweep](MainModelState const& /*state*/,
+                             CalculationMethod calculation_method) -> std::vector<ShortCircuitSolverOutput<sym>> {
             return calculate_<ShortCircuitSolverOutput<sym>, MathSolver<sym>, YBus<sym>, ShortCircuitInput>(
                 [this, voltage_scaling](Idx /* n_math_solvers */) {
-                    assert(is_topology_up_to_date_ && is_parameter_up_to_date<sym>());
+                    assert(is_topology_up_to_date_);
                     return prepare_short_circuit_input<sym>(voltage_scaling);
                 },
-                [this, calculation_method](MathSolver<sym>& solver, YBus<sym> const& y_bus,
-                                           ShortCircuitInput const& input) {
-                    return solver.run_short_circuit(input, calculation_info_, calculation_method, y_bus);
+                [calculation_method, fault_sweep](MathSolver<sym>& solver, YBus<sym> const& y_bus,
+                                                  ShortCircuitInput const& input, CalculationInfo& info) {
+                    if (fault_sweep) {
+                        return solver.run_short_circuit_sweep(input, info, calculation_method, y_bus);
+                    }
+                    return solver.run_short_circuit(input, info, calculation_method, y_bus);
                 });
         };
     }
@@ -435,7 +745,418 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
             return BatchParameter{};
         }
 
-        // calculate once to cache topology, ignore results, all math solvers are initialized
+        cache_batch_calculation_(calculation_fn);
+
+        // error messages
+        std::vector<std::string> exceptions(n_scenarios, "");
+        std::vector<CalculationInfo> infos(n_scenarios);
+
+        auto const batch_sequence = resolve_dependent_batch_(update_data, 0, n_scenarios, threading);
+
+        // lambda for sub batch calculation
+        auto sub_batch =
+            sub_batch_calculation_(calculation_fn, result_data, update_data, exceptions, infos, batch_sequence);
+
+        batch_dispatch(sub_batch, n_scenarios, threading);
+
+        handle_batch_exceptions(exceptions);
+        calculation_info_ = main_core::merge_calculation_info(infos);
+
+        return BatchParameter{};
+    }
+
+    /*
+    run the calculation function in batch, streaming the results chunk by chunk.
+
+    The scenarios are split in chunks of the batch size of the result chunks.
+    Chunk k is written to result_chunks[k % n_chunks] and handed over to consume_chunk asynchronously,
+    while chunk k + 1 is being calculated.
+    With a single result chunk, the consumer needs to finish before the next chunk is calculated.
+
+    The update data is either a batch dataset containing all scenarios,
+    or an update stream that provides the update data for each chunk on request.
+    */
+    template <typename Calculate, typename UpdateSource>
+        requires std::invocable<std::remove_cvref_t<Calculate>, MainModelImpl&, MutableDataset const&, Idx> &&
+                 (std::same_as<UpdateSource, ConstDataset> || std::same_as<UpdateSource, UpdateStream>)
+    BatchParameter streaming_batch_calculation_(Calculate&& calculation_fn, BatchStream const& batch_stream,
+                                                UpdateSource const& update_source, Idx threading = -1) {
+        constexpr bool is_update_streamed = std::same_as<UpdateSource, UpdateStream>;
+
+        auto const& result_chunks = batch_stream.result_chunks;
+        if (result_chunks.empty()) {
+            throw DatasetError{"Streaming batch calculation requires at least one result chunk!\n"};
+        }
+        Idx const chunk_size = result_chunks.front().batch_size();
+        if (chunk_size < 1 || std::ranges::any_of(result_chunks, [chunk_size](MutableDataset const& chunk) {
+                return !chunk.is_batch() || chunk.batch_size() != chunk_size;
+            })) {
+            throw DatasetError{"All result chunks should be batch datasets of the same non-zero size!\n"};
+        }
+
+        Idx const n_scenarios = [&update_source] {
+            if constexpr (is_update_streamed) {
+                return update_source.n_scenarios;
+            } else {
+                return update_source.batch_size();
+            }
+        }();
+        if (n_scenarios == 0) {
+            return BatchParameter{};
+        }
+
+        cache_batch_calculation_(calculation_fn);
+
+        // the independence of a complete update dataset only needs to be checked once
+        bool const is_full_update_independent = [&update_source] {
+            if constexpr (is_update_streamed) {
+                return false;
+            } else {
+                return MainModelImpl::is_update_independent(update_source);
+            }
+        }();
+
+        std::vector<std::string> exceptions(n_scenarios, "");
+        CalculationInfo streaming_info;
+
+        std::future<void> pending_consumer;
+        auto wait_for_consumer = [&pending_consumer] {
+            if (pending_consumer.valid()) {
+                pending_consumer.get();
+            }
+        };
+
+        for (Idx chunk_start = 0, chunk_number = 0; chunk_start < n_scenarios;
+             chunk_start += chunk_size, ++chunk_number) {
+            Idx const n_chunk_scenarios = std::min(chunk_size, n_scenarios - chunk_start);
+            MutableDataset const& result_chunk = result_chunks[chunk_number % std::ssize(result_chunks)];
+
+            // with only one chunk in the ring, its previous content has to be consumed before it is overwritten
+            if (std::ssize(result_chunks) == 1) {
+                wait_for_consumer();
+            }
+
+            std::vector<std::string> chunk_exceptions(n_chunk_scenarios, "");
+            std::vector<CalculationInfo> chunk_infos(n_chunk_scenarios);
+            if constexpr (is_update_streamed) {
+                ConstDataset const chunk_update = update_source.get_chunk(chunk_start, n_chunk_scenarios);
+                if (chunk_update.batch_size() != n_chunk_scenarios) {
+                    throw DatasetError{"The update chunk does not have the requested number of scenarios!\n"};
+                }
+                auto const batch_sequence = resolve_dependent_batch_(chunk_update, 0, n_chunk_scenarios, threading);
+                batch_dispatch(sub_batch_calculation_(calculation_fn, result_chunk, chunk_update, chunk_exceptions,
+                                                      chunk_infos, batch_sequence),
+                               n_chunk_scenarios, threading);
+            } else {
+                // a dependent dataset is resolved per chunk, to limit the memory to the size of a chunk
+                auto const batch_sequence =
+                    is_full_update_independent
+                        ? std::nullopt
+                        : std::optional{get_batch_sequence_idx_map(update_source, chunk_start, n_chunk_scenarios,
+                                                                   threading)};
+                batch_dispatch(sub_batch_calculation_(calculation_fn, result_chunk, update_source, chunk_exceptions,
+                                                      chunk_infos, batch_sequence, chunk_start),
+                               n_chunk_scenarios, threading);
+            }
+
+            std::ranges::move(chunk_exceptions, std::next(exceptions.begin(), chunk_start));
+            streaming_info = main_core::merge_calculation_info(
+                {std::move(streaming_info), main_core::merge_calculation_info(chunk_infos)});
+
+            // hand over the chunk and continue with the next one while it is being consumed
+            wait_for_consumer();
+            pending_consumer = std::async(std::launch::async, [&batch_stream, &result_chunk, chunk_start,
+                                                               n_chunk_scenarios] {
+                batch_stream.consume_chunk(chunk_start, n_chunk_scenarios, result_chunk);
+            });
+        }
+        wait_for_consumer();
+
+        handle_batch_exceptions(exceptions);
+        calculation_info_ = std::move(streaming_info);
+
+        return BatchParameter{};
+    }
+
+    /*
+    run the calculation function in batch, aggregating the results on the fly instead of producing batch output.
+
+    Each thread calculates its scenarios into the single scenario output of its own partial result
+    and accumulates it directly afterwards.
+    The partial results of all threads are merged at the end, also when some of the scenarios failed.
+    */
+    template <typename Calculate, batch_aggregation Aggregation>
+        requires std::invocable<std::remove_cvref_t<Calculate>, MainModelImpl&, MutableDataset const&, Idx>
+    BatchParameter aggregated_batch_calculation_(Calculate&& calculation_fn, Aggregation& aggregation,
+                                                 std::string_view output_dataset, ConstDataset const& update_data,
+                                                 Idx threading = -1) {
+        Idx const n_scenarios = update_data.batch_size();
+        auto partials =
+            aggregation.begin_batch(std::max(batch_thread_count(threading, n_scenarios), Idx{1}), *meta_data_,
+                                    output_dataset, all_component_count());
+        if (n_scenarios == 0) {
+            aggregation.end_batch(partials);
+            return BatchParameter{};
+        }
+
+        cache_batch_calculation_(calculation_fn);
+
+        std::vector<std::string> exceptions(n_scenarios, "");
+        std::vector<CalculationInfo> infos(n_scenarios);
+        auto const batch_sequence = resolve_dependent_batch_(update_data, 0, n_scenarios, threading);
+
+        auto sub_batch = [this, &calculation_fn, &partials, &update_data, &exceptions, &infos,
+                          &batch_sequence](Idx start, Idx stride, Idx n_scenarios_in_batch) {
+            auto& partial = partials[start];
+            auto calculate_and_accumulate = [&calculation_fn, &partial](
+                                                MainModelImpl& model, MutableDataset const& scenario_output,
+                                                Idx scenario_idx) {
+                calculation_fn(model, scenario_output, 0);
+                partial.accumulate(scenario_idx);
+            };
+            sub_batch_calculation_(calculate_and_accumulate, partial.scenario_output(), update_data, exceptions,
+                                   infos, batch_sequence)(start, stride, n_scenarios_in_batch);
+        };
+        batch_dispatch(sub_batch, n_scenarios, threading);
+
+        aggregation.end_batch(partials);
+        handle_batch_exceptions(exceptions);
+        calculation_info_ = main_core::merge_calculation_info(infos);
+
+        return BatchParameter{};
+    }
+
+    /*
+    run an N-1 contingency power flow in batch, with one scenario per outaged branch or branch3.
+
+    The scenarios are generated internally by switching off the outaged component at all sides.
+    With the linear method, an outage that does not change the island structure is solved by compensation
+    on the factorization of the base case, without rebuilding the topology.
+    All other outages are calculated like a regular update scenario, including a topology rebuild.
+    */
+    template <symmetry_tag sym>
+    BatchParameter contingency_batch_calculation_(Options const& options, MutableDataset const& result_data,
+                                                  std::span<ID const> outage_ids) {
+        Idx const n_scenarios = std::ssize(outage_ids);
+        if (result_data.batch_size() != n_scenarios) {
+            throw DatasetError{"The result dataset should have exactly one scenario per outage!\n"};
+        }
+        for (ID const outage_id : outage_ids) {
+            run_functor_with_outage_type_(outage_id, []<typename CT>(Idx2D const& /* idx */) {});
+        }
+        if (n_scenarios == 0) {
+            return BatchParameter{};
+        }
+
+        auto const calculation_fn = [&options](MainModelImpl& model, MutableDataset const& target_data, Idx pos) {
+            auto sub_opt = options; // copy
+            sub_opt.err_tol = pos != ignore_output ? options.err_tol : std::numeric_limits<double>::max();
+            sub_opt.max_iter = pos != ignore_output ? options.max_iter : 1;
+            sub_opt.threading = Options::sequential;
+
+            model.calculate_power_flow<sym>(sub_opt, target_data, pos);
+        };
+        cache_batch_calculation_(calculation_fn);
+
+        bool const use_compensation = options.calculation_method == CalculationMethod::linear &&
+                                      options.optimizer_type == OptimizerType::no_optimization;
+        std::vector<std::string> exceptions(n_scenarios, "");
+        std::vector<CalculationInfo> infos(n_scenarios);
+
+        auto sub_batch = [&base_model = std::as_const(*this), &calculation_fn, &result_data, outage_ids,
+                          use_compensation, &exceptions, &infos](Idx start, Idx stride, Idx n_scenarios_in_batch) {
+            Timer const t_total(infos[start], 0000, "Total in thread");
+
+            auto copy_model = [&base_model, &infos](Idx scenario_idx) {
+                Timer const t_copy_model(infos[scenario_idx], 1100, "Copy model");
+                return MainModelImpl{base_model};
+            };
+            auto model = copy_model(start);
+            SequenceIdx outage_sequence{};
+            OutageCoupling outage_coupling{};
+
+            auto calculate_scenario = MainModelImpl::call_with<Idx>(
+                [&model, &calculation_fn, &result_data, outage_ids, use_compensation, &outage_sequence,
+                 &outage_coupling, &infos](Idx scenario_idx) {
+                    if (!use_compensation ||
+                        !model.template calculate_outage_by_compensation_<sym>(outage_ids[scenario_idx], result_data,
+                                                                      scenario_idx, outage_coupling)) {
+                        Timer const t_update_model(infos[scenario_idx], 1200, "Update model");
+                        model.update_outage_(outage_ids[scenario_idx], outage_sequence);
+                        calculation_fn(model, result_data, scenario_idx);
+                    }
+                    infos[scenario_idx].merge(model.calculation_info_);
+                },
+                [](Idx /* scenario_idx */) {},
+                [&model, &outage_sequence, &infos](Idx scenario_idx) {
+                    Timer const t_update_model(infos[scenario_idx], 1201, "Restore model");
+                    model.restore_components(outage_sequence);
+                    std::ranges::for_each(outage_sequence, [](auto& comp_seq_idx) { comp_seq_idx.clear(); });
+                },
+                scenario_exception_handler(model, exceptions, infos),
+                [&model, &copy_model](Idx scenario_idx) { model = copy_model(scenario_idx); });
+
+            for (Idx scenario_idx = start; scenario_idx < n_scenarios_in_batch; scenario_idx += stride) {
+                Timer const t_total_single(infos[scenario_idx], 0100, "Total single calculation in thread");
+
+                calculate_scenario(scenario_idx);
+            }
+        };
+        batch_dispatch(sub_batch, n_scenarios, options.threading);
+
+        handle_batch_exceptions(exceptions);
+        calculation_info_ = main_core::merge_calculation_info(infos);
+
+        return BatchParameter{};
+    }
+
+    template <symmetry_tag sym>
+    void output_fault_result_(MathOutput<std::vector<ShortCircuitSolverOutput<sym>>> const& math_output,
+                              MutableDataset const& result_data, Idx pos) {
+        Timer const t_output(calculation_info_, 3000, "Produce output");
+        auto const span =
+            result_data.get_buffer_span<output_type_getter<ShortCircuitSolverOutput<sym>>::template type, Fault>(pos);
+        if (!span.empty()) {
+            output_result<Fault>(math_output, span.begin());
+        }
+    }
+
+    // run the functor with the concrete component type of an outaged branch or branch3 and its index
+    // throw if the component is not a branch or branch3
+    template <typename Functor> void run_functor_with_outage_type_(ID outage_id, Functor functor) const {
+        Idx2D const idx = main_core::get_component_idx_by_id(state_, outage_id);
+        bool found = false;
+        run_functor_with_all_types_return_void([this, &idx, &found, &functor]<typename CT>() {
+            if constexpr (std::derived_from<CT, Branch> || std::derived_from<CT, Branch3>) {
+                if (idx.group == main_core::get_component_type_index<CT>(state_)) {
+                    found = true;
+                    functor.template operator()<CT>(idx);
+                }
+            }
+        });
+        if (!found) {
+            throw IDWrongType{outage_id};
+        }
+    }
+
+    // switch off a branch or branch3 at all sides, the inverse update is cached to be restored afterwards
+    void update_outage_(ID outage_id, SequenceIdx& sequence_idx) {
+        run_functor_with_outage_type_(outage_id, [this, outage_id, &sequence_idx]<typename CT>(Idx2D const& idx) {
+            typename CT::UpdateType update{};
+            update.id = outage_id;
+            if constexpr (std::derived_from<CT, Branch>) {
+                BranchUpdate& branch_update = update;
+                branch_update.from_status = 0;
+                branch_update.to_status = 0;
+            } else {
+                Branch3Update& branch3_update = update;
+                branch3_update.status_1 = 0;
+                branch3_update.status_2 = 0;
+                branch3_update.status_3 = 0;
+            }
+            auto& component_sequence = std::get<index_of_component<CT>>(sequence_idx);
+            component_sequence = {idx};
+            update_component<CT, cached_update_t>(std::vector{update}, component_sequence);
+        });
+    }
+
+    // copy of the coupling of the model, in which the outaged component is decoupled while producing the output
+    //    the model copy of each thread has its own, it is only copied again if the topology is rebuilt
+    struct OutageCoupling {
+        std::shared_ptr<TopologicalComponentToMathCoupling const> base;
+        std::shared_ptr<TopologicalComponentToMathCoupling> decoupled;
+    };
+
+    // linear power flow of an outage by compensation on the factorization of the current model
+    // return false without calculating if the outage changes the island structure
+    template <symmetry_tag sym>
+    bool calculate_outage_by_compensation_(ID outage_id, MutableDataset const& result_data, Idx pos,
+                                           OutageCoupling& outage_coupling) {
+        calculation_info_ = CalculationInfo{};
+        {
+            Timer const timer(calculation_info_, 2100, "Prepare");
+            prepare_solvers<sym>();
+        }
+        if (outage_coupling.base != state_.topo_comp_coup) {
+            outage_coupling.base = state_.topo_comp_coup;
+            outage_coupling.decoupled = std::make_shared<TopologicalComponentToMathCoupling>(*state_.topo_comp_coup);
+        }
+
+        math_solver::BranchOutage outage;
+        Idx group{-1};
+        Idx2D* branch_math_id{};
+        Idx2DBranch3* branch3_math_id{};
+        run_functor_with_outage_type_(outage_id, [this, &outage_coupling, &outage, &group, &branch_math_id,
+                                                  &branch3_math_id]<typename CT>(Idx2D const& idx) {
+            if constexpr (std::derived_from<CT, Branch>) {
+                branch_math_id =
+                    &outage_coupling.decoupled->branch[main_core::get_component_sequence<Branch>(state_, idx)];
+                group = branch_math_id->group;
+                outage.branches = {branch_math_id->pos};
+            } else {
+                branch3_math_id =
+                    &outage_coupling.decoupled->branch3[main_core::get_component_sequence<Branch3>(state_, idx)];
+                group = branch3_math_id->group;
+                outage.branches = {branch3_math_id->pos.cbegin(), branch3_math_id->pos.cend()};
+                if (group != -1) {
+                    // the internal node is always at the to side of the branches of a branch3
+                    outage.dropped_buses = {state_.math_topology[group]->branch_bus_idx[outage.branches.front()][1]};
+                }
+            }
+        });
+        if (group == -1) {
+            return false;
+        }
+        if (!math_solver::is_island_preserved(*state_.math_topology[group], outage)) {
+            return false;
+        }
+
+        auto const math_output = [this, group, &outage] {
+            Timer const timer(calculation_info_, 2200, "Math Calculation");
+            auto const input = prepare_power_flow_input<sym>(state_, n_math_solvers_);
+            auto& solvers = get_solvers<sym>();
+            auto& y_bus_vec = get_y_bus<sym>();
+            MathOutput<std::vector<SolverOutput<sym>>> result{};
+            result.solver_output.reserve(n_math_solvers_);
+            for (Idx i = 0; i != n_math_solvers_; ++i) {
+                result.solver_output.emplace_back(solvers[i].run_power_flow_with_outage(
+                    input[i], i == group ? outage : math_solver::BranchOutage{}, calculation_info_, y_bus_vec[i]));
+            }
+            return result;
+        }();
+
+        // decouple the outaged component, so that its output is the one of a disconnected one
+        Idx2D const coupled_branch =
+            branch_math_id != nullptr ? std::exchange(*branch_math_id, Idx2D{.group = -1, .pos = -1}) : Idx2D{};
+        Idx2DBranch3 const coupled_branch3 =
+            branch3_math_id != nullptr
+                ? std::exchange(*branch3_math_id, Idx2DBranch3{.group = -1, .pos = {-1, -1, -1}})
+                : Idx2DBranch3{};
+        auto const coupling = std::exchange(state_.topo_comp_coup, outage_coupling.decoupled);
+        auto const restore_coupling = [this, &coupling, branch_math_id, branch3_math_id, &coupled_branch,
+                                       &coupled_branch3] {
+            state_.topo_comp_coup = coupling;
+            if (branch_math_id != nullptr) {
+                *branch_math_id = coupled_branch;
+            }
+            if (branch3_math_id != nullptr) {
+                *branch3_math_id = coupled_branch3;
+            }
+        };
+        try {
+            output_result(math_output, result_data, pos);
+        } catch (...) {
+            restore_coupling();
+            throw;
+        }
+        restore_coupling();
+        return true;
+    }
+
+    // calculate once to cache topology, ignore results, all math solvers are initialized
+    template <typename Calculate>
+        requires std::invocable<std::remove_cvref_t<Calculate>, MainModelImpl&, MutableDataset const&, Idx>
+    void cache_batch_calculation_(Calculate&& calculation_fn) {
         try {
             calculation_fn(*this,
                            {
@@ -450,35 +1171,33 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
         } catch (const NotObservableError&) {
             // missing entries are provided in the update data
         }
+    }
 
-        // error messages
-        std::vector<std::string> exceptions(n_scenarios, "");
-        std::vector<CalculationInfo> infos(n_scenarios);
-
-        // lambda for sub batch calculation
-        auto sub_batch = sub_batch_calculation_(calculation_fn, result_data, update_data, exceptions, infos);
-
-        batch_dispatch(sub_batch, n_scenarios, threading);
-
-        handle_batch_exceptions(exceptions);
-        calculation_info_ = main_core::merge_calculation_info(infos);
-
-        return BatchParameter{};
+    // resolve the sequence idx of the scenarios of a dependent update dataset at once,
+    // nothing for an independent one, of which the sequence idx is resolved once per thread
+    std::optional<BatchSequenceIdx> resolve_dependent_batch_(ConstDataset const& update_data, Idx begin_scenario,
+                                                             Idx n_scenarios, Idx threading) const {
+        if (MainModelImpl::is_update_independent(update_data)) {
+            return std::nullopt;
+        }
+        return get_batch_sequence_idx_map(update_data, begin_scenario, n_scenarios, threading);
     }
 
+    // the scenarios in result_data, exceptions and infos start at 0,
+    // the scenarios in update_data start at update_offset
+    // batch_sequence contains the resolved sequence idx of a dependent update dataset,
+    // and is empty for an independent one
     template <typename Calculate>
         requires std::invocable<std::remove_cvref_t<Calculate>, MainModelImpl&, MutableDataset const&, Idx>
     auto sub_batch_calculation_(Calculate&& calculation_fn, MutableDataset const& result_data,
                                 ConstDataset const& update_data, std::vector<std::string>& exceptions,
-                                std::vector<CalculationInfo>& infos) {
+                                std::vector<CalculationInfo>& infos,
+                                std::optional<BatchSequenceIdx> const& batch_sequence, Idx update_offset = 0) {
         // const ref of current instance
         MainModelImpl const& base_model = *this;
 
-        // cache component update order if possible
-        bool const is_independent = MainModelImpl::is_update_independent(update_data);
-
-        return [&base_model, &exceptions, &infos, &calculation_fn, &result_data, &update_data,
-                is_independent](Idx start, Idx stride, Idx n_scenarios) {
+        return [&base_model, &exceptions, &infos, &calculation_fn, &result_data, &update_data, &batch_sequence,
+                update_offset](Idx start, Idx stride, Idx n_scenarios) {
             assert(n_scenarios <= narrow_cast<Idx>(exceptions.size()));
             assert(n_scenarios <= narrow_cast<Idx>(infos.size()));
 
@@ -490,10 +1209,12 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
             };
             auto model = copy_model(start);
 
-            SequenceIdx scenario_sequence = is_independent ? model.get_sequence_idx_map(update_data) : SequenceIdx{};
+            // cache component update order if possible
+            SequenceIdx scenario_sequence =
+                batch_sequence.has_value() ? SequenceIdx{} : model.get_sequence_idx_map(update_data);
 
             auto [setup, winddown] =
-                scenario_update_restore(model, update_data, is_independent, scenario_sequence, infos);
+                scenario_update_restore(model, update_data, batch_sequence, scenario_sequence, infos, update_offset);
 
             auto calculate_scenario = MainModelImpl::call_with<Idx>(
                 [&model, &calculation_fn, &result_data, &infos](Idx scenario_idx) {
@@ -515,17 +1236,26 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
     //    specified threading < 0
     //    use hardware threads, but it is either unknown (0) or only has one thread (1)
     //    specified threading = 1
+    // otherwise, the number of threads is limited by the number of scenarios
+    static Idx batch_thread_count(Idx threading, Idx n_scenarios) {
+        auto const hardware_thread = static_cast<Idx>(std::thread::hardware_concurrency());
+        if (threading < 0 || threading == 1 || (threading == 0 && hardware_thread < 2)) {
+            return 1;
+        }
+        return std::min(threading == 0 ? hardware_thread : threading, n_scenarios);
+    }
+
+    // each thread calculates the scenarios start, start + stride, ... in a sub batch
     template <typename RunSubBatchFn>
         requires std::invocable<std::remove_cvref_t<RunSubBatchFn>, Idx /*start*/, Idx /*stride*/, Idx /*n_scenarios*/>
     static void batch_dispatch(RunSubBatchFn sub_batch, Idx n_scenarios, Idx threading) {
         // run batches sequential or parallel
-        auto const hardware_thread = static_cast<Idx>(std::thread::hardware_concurrency());
-        if (threading < 0 || threading == 1 || (threading == 0 && hardware_thread < 2)) {
+        Idx const n_thread = batch_thread_count(threading, n_scenarios);
+        if (n_thread == 1) {
             // run all in sequential
             sub_batch(0, 1, n_scenarios);
         } else {
             // create parallel threads
-            Idx const n_thread = std::min(threading == 0 ? hardware_thread : threading, n_scenarios);
             std::vector<std::thread> threads;
             threads.reserve(n_thread);
             for (Idx thread_number = 0; thread_number < n_thread; ++thread_number) {
@@ -566,15 +1296,19 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
     }
 
     static auto scenario_update_restore(MainModelImpl& model, ConstDataset const& update_data,
-                                        bool const is_independent, SequenceIdx& scenario_sequence,
-                                        std::vector<CalculationInfo>& infos) {
+                                        std::optional<BatchSequenceIdx> const& batch_sequence,
+                                        SequenceIdx& scenario_sequence, std::vector<CalculationInfo>& infos,
+                                        Idx update_offset = 0) {
+        bool const is_independent = !batch_sequence.has_value();
         return std::make_pair(
-            [&model, &update_data, &scenario_sequence, is_independent, &infos](Idx scenario_idx) {
+            [&model, &update_data, &batch_sequence, &scenario_sequence, &infos, update_offset](Idx scenario_idx) {
                 Timer const t_update_model(infos[scenario_idx], 1200, "Update model");
-                if (!is_independent) {
-                    scenario_sequence = model.get_sequence_idx_map(update_data, scenario_idx);
+                if (batch_sequence.has_value()) {
+                    model.get_sequence_idx_map(*batch_sequence, update_data, scenario_idx + update_offset,
+                                               scenario_sequence);
                 }
-                model.template update_component<cached_update_t>(update_data, scenario_idx, scenario_sequence);
+                model.template update_component<cached_update_t>(update_data, scenario_idx + update_offset,
+                                                                 scenario_sequence);
             },
             [&model, &scenario_sequence, is_independent, &infos](Idx scenario_idx) {
                 Timer const t_update_model(infos[scenario_idx], 1201, "Restore model");
@@ -662,9 +1396,9 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
     template <symmetry_tag sym> auto calculate_power_flow(Options const& options) {
         return optimizer::get_optimizer<MainModelState, ConstDataset>(
                    options.optimizer_type, options.optimizer_strategy,
-                   calculate_power_flow_<sym>(options.err_tol, options.max_iter),
-                   [this](ConstDataset update_data) { this->update_component<permanent_update_t>(update_data); },
-                   *meta_data_)
+                   calculate_power_flow_<sym>(options.err_tol, options.max_iter, options.threading),
+                   [this](auto const& update_data) { this->update_optimized_component(update_data); },
+                   *meta_data_, &regulator_order_cache_, options.optimizer_warm_start)
             ->optimize(state_, options.calculation_method);
     }
 
@@ -684,16 +1418,60 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
     BatchParameter calculate_power_flow(Options const& options, MutableDataset const& result_data,
                                         ConstDataset const& update_data) {
         return batch_calculation_(
-            [&options](MainModelImpl& model, MutableDataset const& target_data, Idx pos) {
+            [&options, is_single_calculation = update_data.empty()](MainModelImpl& model,
+                                                                   MutableDataset const& target_data, Idx pos) {
                 auto sub_opt = options; // copy
                 sub_opt.err_tol = pos != ignore_output ? options.err_tol : std::numeric_limits<double>::max();
                 sub_opt.max_iter = pos != ignore_output ? options.max_iter : 1;
+                // the threads are used for the islands only if there is no batch
+                sub_opt.threading = is_single_calculation ? options.threading : Options::sequential;
 
                 model.calculate_power_flow<sym>(sub_opt, target_data, pos);
             },
             result_data, update_data, options.threading);
     }
 
+    // Streaming batch load flow calculation, handing over the results chunk by chunk
+    template <symmetry_tag sym, typename UpdateSource>
+        requires std::same_as<UpdateSource, ConstDataset> || std::same_as<UpdateSource, UpdateStream>
+    BatchParameter calculate_power_flow(Options const& options, BatchStream const& batch_stream,
+                                        UpdateSource const& update_source) {
+        return streaming_batch_calculation_(
+            [&options](MainModelImpl& model, MutableDataset const& target_data, Idx pos) {
+                auto sub_opt = options; // copy
+                sub_opt.err_tol = pos != ignore_output ? options.err_tol : std::numeric_limits<double>::max();
+                sub_opt.max_iter = pos != ignore_output ? options.max_iter : 1;
+                sub_opt.threading = Options::sequential;
+
+                model.calculate_power_flow<sym>(sub_opt, target_data, pos);
+            },
+            batch_stream, update_source, options.threading);
+    }
+
+    // Batch load flow calculation, aggregating the results on the fly
+    template <symmetry_tag sym, batch_aggregation Aggregation>
+    BatchParameter calculate_power_flow(Options const& options, Aggregation& aggregation,
+                                        ConstDataset const& update_data) {
+        return aggregated_batch_calculation_(
+            [&options](MainModelImpl& model, MutableDataset const& target_data, Idx pos) {
+                auto sub_opt = options; // copy
+                sub_opt.err_tol = pos != ignore_output ? options.err_tol : std::numeric_limits<double>::max();
+                sub_opt.max_iter = pos != ignore_output ? options.max_iter : 1;
+                sub_opt.threading = Options::sequential;
+
+                model.calculate_power_flow<sym>(sub_opt, target_data, pos);
+            },
+            aggregation, is_symmetric_v<sym> ? "sym_output" : "asym_output", update_data, options.threading);
+    }
+
+    // N-1 contingency load flow calculation, one scenario per outage of a branch or branch3 in outage_ids,
+    // propagating the results to result_data
+    template <symmetry_tag sym>
+    BatchParameter calculate_power_flow(Options const& options, MutableDataset const& result_data,
+                                        std::span<ID const> outage_ids) {
+        return contingency_batch_calculation_<sym>(options, result_data, outage_ids);
+    }
+
     // Single state estimation calculation, returning math output results
     template <symmetry_tag sym> auto calculate_state_estimation(Options const& options) {
         return MathOutput<std::vector<SolverOutput<sym>>>{
@@ -706,6 +1484,11 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
     template <symmetry_tag sym>
     void calculate_state_estimation(Options const& options, MutableDataset const& result_data, Idx pos = 0) {
         assert(construction_complete_);
+        if (pos == ignore_output) {
+            // the observability is checked before the solvers are prepared, but the cache run of a batch should
+            //    prepare them anyway, the missing sensors may be provided by the update data
+            prepare_solvers<sym>();
+        }
         auto const solver_output = calculate_state_estimation<sym>(options);
 
         if (pos != ignore_output) {
@@ -713,6 +1496,31 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
         }
     }
 
+    // Check the observability of the state estimation without solving it, throw NotObservableError if not observable
+    //    the observability only depends on the topology and the sensors, so the Y bus and the solvers are not prepared
+    //    the math solvers keep the sensor mapping of the check, like in a state estimation
+    template <symmetry_tag sym> void check_observability(Options const& /*options*/) {
+        assert(construction_complete_);
+        calculation_info_ = CalculationInfo{};
+        Timer const timer(calculation_info_, 2100, "Prepare");
+        if (!is_topology_up_to_date_) {
+            rebuild_topology();
+        }
+        check_observability_<sym>(prepare_state_estimation_input<sym>(state_, n_math_solvers_));
+    }
+
+    // Batch pre-pass of the state estimation, flagging the unobservable scenarios before any solver work is done
+    //    raise a BatchCalculationError if any of the scenarios is not observable
+    template <symmetry_tag sym>
+    BatchParameter check_observability(Options const& options, ConstDataset const& update_data) {
+        return batch_calculation_(
+            [&options](MainModelImpl& model, MutableDataset const& /*target_data*/, Idx /*pos*/) {
+                model.check_observability<sym>(options);
+            },
+            MutableDataset{false, 1, is_symmetric_v<sym> ? "sym_output" : "asym_output", *meta_data_}, update_data,
+            options.threading);
+    }
+
     // Batch state estimation calculation, propagating the results to result_data
     template <symmetry_tag sym>
     BatchParameter calculate_state_estimation(Options const& options, MutableDataset const& result_data,
@@ -729,6 +1537,39 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
             result_data, update_data, options.threading);
     }
 
+    // Streaming batch state estimation calculation, handing over the results chunk by chunk
+    template <symmetry_tag sym, typename UpdateSource>
+        requires std::same_as<UpdateSource, ConstDataset> || std::same_as<UpdateSource, UpdateStream>
+    BatchParameter calculate_state_estimation(Options const& options, BatchStream const& batch_stream,
+                                              UpdateSource const& update_source) {
+        return streaming_batch_calculation_(
+            [&options](MainModelImpl& model, MutableDataset const& target_data, Idx pos) {
+                auto sub_opt = options; // copy
+
+                sub_opt.err_tol = pos != ignore_output ? options.err_tol : std::numeric_limits<double>::max();
+                sub_opt.max_iter = pos != ignore_output ? options.max_iter : 1;
+
+                model.calculate_state_estimation<sym>(sub_opt, target_data, pos);
+            },
+            batch_stream, update_source, options.threading);
+    }
+
+    // Batch state estimation calculation, aggregating the results on the fly
+    template <symmetry_tag sym, batch_aggregation Aggregation>
+    BatchParameter calculate_state_estimation(Options const& options, Aggregation& aggregation,
+                                              ConstDataset const& update_data) {
+        return aggregated_batch_calculation_(
+            [&options](MainModelImpl& model, MutableDataset const& target_data, Idx pos) {
+                auto sub_opt = options; // copy
+
+                sub_opt.err_tol = pos != ignore_output ? options.err_tol : std::numeric_limits<double>::max();
+                sub_opt.max_iter = pos != ignore_output ? options.max_iter : 1;
+
+                model.calculate_state_estimation<sym>(sub_opt, target_data, pos);
+            },
+            aggregation, is_symmetric_v<sym> ? "sym_output" : "asym_output", update_data, options.threading);
+    }
+
     // Single short circuit calculation, returning short circuit math output results
     template <symmetry_tag sym> auto calculate_short_circuit(Options const& options) {
         return MathOutput<std::vector<ShortCircuitSolverOutput<sym>>>{
@@ -763,6 +1604,57 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
             result_data, update_data, options.threading);
     }
 
+    // Streaming batch short circuit calculation, handing over the results chunk by chunk
+    template <typename UpdateSource>
+        requires std::same_as<UpdateSource, ConstDataset> || std::same_as<UpdateSource, UpdateStream>
+    BatchParameter calculate_short_circuit(Options const& options, BatchStream const& batch_stream,
+                                           UpdateSource const& update_source) {
+        return streaming_batch_calculation_(
+            [&options](MainModelImpl& model, MutableDataset const& target_data, Idx pos) {
+                if (pos != ignore_output) {
+                    model.calculate_short_circuit(options, target_data, pos);
+                }
+            },
+            batch_stream, update_source, options.threading);
+    }
+
+    // Batch short circuit calculation, aggregating the results on the fly
+    template <batch_aggregation Aggregation>
+    BatchParameter calculate_short_circuit(Options const& options, Aggregation& aggregation,
+                                           ConstDataset const& update_data) {
+        return aggregated_batch_calculation_(
+            [&options](MainModelImpl& model, MutableDataset const& target_data, Idx pos) {
+                if (pos != ignore_output) {
+                    model.calculate_short_circuit(options, target_data, pos);
+                }
+            },
+            aggregation, "sc_output", update_data, options.threading);
+    }
+
+    // Short circuit fault sweep, returning short circuit math output results
+    //    only the fault output of the math output is calculated
+    template <symmetry_tag sym> auto calculate_short_circuit_sweep(Options const& options) {
+        return MathOutput<std::vector<ShortCircuitSolverOutput<sym>>>{
+            .solver_output = calculate_short_circuit_<sym>(options.short_circuit_voltage_scaling, true)(
+                state_, options.calculation_method),
+            .optimizer_output = {}};
+    }
+
+    // Short circuit fault sweep, propagating the fault results to result_data
+    //    every enabled fault is calculated as if it were the only fault in the network,
+    //    faults of different types and phases can be mixed
+    //    the network is factorized only once for all faults, only the fault output is produced
+    void calculate_short_circuit_sweep(Options const& options, MutableDataset const& result_data, Idx pos = 0) {
+        assert(construction_complete_);
+        if (std::all_of(state_.components.template citer<Fault>().begin(),
+                        state_.components.template citer<Fault>().end(),
+                        [](Fault const& fault) { return fault.get_fault_type() == FaultType::three_phase; })) {
+            output_fault_result_(calculate_short_circuit_sweep<symmetric_t>(options), result_data, pos);
+        } else {
+            output_fault_result_(calculate_short_circuit_sweep<asymmetric_t>(options), result_data, pos);
+        }
+    }
+
     template <typename Component, typename MathOutputType, std::forward_iterator ResIt>
         requires solver_output_type<typename MathOutputType::SolverOutputType::value_type>
     ResIt output_result(MathOutputType const& math_output, ResIt res_it) const {
@@ -803,9 +1695,17 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
     bool is_accumulated_component_updated_{true};
     bool last_updated_calculation_symmetry_mode_{false};
 
+    // the islands of the topology before the last structural edit
+    struct PreviousIslands {
+        std::vector<std::shared_ptr<MathModelTopology const>> math_topology;
+        MathState math_state;
+    };
+    std::optional<PreviousIslands> previous_islands_{};
+
     OwnedUpdateDataset cached_inverse_update_{};
     UpdateChange cached_state_changes_{};
     std::array<std::vector<Idx2D>, n_types> parameter_changed_components_{};
+    optimizer::tap_position_optimizer::RegulatorOrderCache regulator_order_cache_{};
 #ifndef NDEBUG
     // construction_complete is used for debug assertions only
     bool construction_complete_{false};
@@ -819,27 +1719,26 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
         }
     }
 
-    template <symmetry_tag sym> std::vector<MathSolver<sym>>& get_solvers() {
+    template <symmetry_tag sym> static std::vector<MathSolver<sym>>& get_solvers(MathState& math_state) {
         if constexpr (is_symmetric_v<sym>) {
-            return math_state_.math_solvers_sym;
+            return math_state.math_solvers_sym;
         } else {
-            return math_state_.math_solvers_asym;
+            return math_state.math_solvers_asym;
         }
     }
+    template <symmetry_tag sym> std::vector<MathSolver<sym>>& get_solvers() { return get_solvers<sym>(math_state_); }
 
-    template <symmetry_tag sym> std::vector<YBus<sym>>& get_y_bus() {
+    template <symmetry_tag sym> static std::vector<YBus<sym>>& get_y_bus(MathState& math_state) {
         if constexpr (is_symmetric_v<sym>) {
-            return math_state_.y_bus_vec_sym;
+            return math_state.y_bus_vec_sym;
         } else {
-            return math_state_.y_bus_vec_asym;
+            return math_state.y_bus_vec_asym;
         }
     }
+    template <symmetry_tag sym> std::vector<YBus<sym>>& get_y_bus() { return get_y_bus<sym>(math_state_); }
 
-    void rebuild_topology() {
-        assert(construction_complete_);
-        // clear old solvers
-        reset_solvers();
-        // get connection info
+    // get connection info
+    ComponentConnections get_component_connections() const {
         ComponentConnections comp_conn;
         comp_conn.branch_connected.resize(state_.comp_topo->branch_node_idx.size());
         comp_conn.branch_phase_shift.resize(state_.comp_topo->branch_node_idx.size());
@@ -866,13 +1765,113 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
         std::transform(state_.components.template citer<Source>().begin(),
                        state_.components.template citer<Source>().end(), comp_conn.source_connected.begin(),
                        [](Source const& source) { return source.status(); });
+        return comp_conn;
+    }
+
+    void rebuild_topology() {
+        assert(construction_complete_);
+        // clear old solvers
+        reset_solvers();
         // re build
+        ComponentConnections const comp_conn = get_component_connections();
         Topology topology{*state_.comp_topo, comp_conn};
         std::tie(state_.math_topology, state_.topo_comp_coup) = topology.build_topology();
         n_math_solvers_ = static_cast<Idx>(state_.math_topology.size());
         is_topology_up_to_date_ = true;
         is_sym_parameter_up_to_date_ = false;
         is_asym_parameter_up_to_date_ = false;
+        if (previous_islands_.has_value()) {
+            reuse_islands(previous_islands_.value());
+            previous_islands_.reset();
+        }
+    }
+
+    // reuse the math topology, the Y bus and the solvers of the islands which are not affected by a structural edit
+    //    an island is reused if its math topology is equal to the one of a previous island,
+    //    its Y bus and solvers only if its parameters are equal as well
+    //    the Y bus and the solvers of the other islands are created if they existed before the edit
+    void reuse_islands(PreviousIslands& previous) {
+        auto const n_previous = static_cast<Idx>(previous.math_topology.size());
+        std::vector<bool> is_taken(n_previous, false);
+        auto const is_same_island = [this, &previous, &is_taken](Idx island, Idx previous_island) {
+            return !is_taken[previous_island] &&
+                   *previous.math_topology[previous_island] == *state_.math_topology[island];
+        };
+        IdxVector previous_islands(n_math_solvers_, -1);
+        for (Idx island = 0; island != n_math_solvers_; ++island) {
+            // the islands usually keep their order, so the previous island at the same position is tried first
+            Idx previous_island = island;
+            if (previous_island >= n_previous || !is_same_island(island, previous_island)) {
+                previous_island = 0;
+                while (previous_island != n_previous && !is_same_island(island, previous_island)) {
+                    ++previous_island;
+                }
+            }
+            if (previous_island == n_previous) {
+                continue;
+            }
+            is_taken[previous_island] = true;
+            previous_islands[island] = previous_island;
+            state_.math_topology[island] = previous.math_topology[previous_island];
+        }
+        reuse_island_solvers<symmetric_t>(previous.math_state, previous_islands);
+        reuse_island_solvers<asymmetric_t>(previous.math_state, previous_islands);
+    }
+
+    template <symmetry_tag sym> void reuse_island_solvers(MathState& previous, IdxVector const& previous_islands) {
+        std::vector<YBus<sym>>& previous_y_bus = get_y_bus<sym>(previous);
+        std::vector<MathSolver<sym>>& previous_solvers = get_solvers<sym>(previous);
+        if (previous_solvers.empty()) {
+            return;
+        }
+        std::vector<YBus<sym>>& y_bus_vec = get_y_bus<sym>();
+        std::vector<MathSolver<sym>>& solvers = get_solvers<sym>();
+        std::vector<MathModelParam<sym>> math_params;
+        if (!previous_y_bus.empty()) {
+            math_params = get_math_param<sym>();
+            y_bus_vec.reserve(n_math_solvers_);
+        }
+        solvers.reserve(n_math_solvers_);
+        for (Idx island = 0; island != n_math_solvers_; ++island) {
+            Idx const previous_island = previous_islands[island];
+            bool is_reused = previous_island != -1;
+            if (!previous_y_bus.empty()) {
+                is_reused = is_reused && is_equal_math_param(previous_y_bus[previous_island].math_model_param(),
+                                                             math_params[island]);
+                if (is_reused) {
+                    y_bus_vec.push_back(std::move(previous_y_bus[previous_island]));
+                } else {
+                    add_y_bus<sym>(island, std::move(math_params[island]));
+                }
+            }
+            if (is_reused) {
+                solvers.push_back(std::move(previous_solvers[previous_island]));
+            } else {
+                solvers.emplace_back(state_.math_topology[island]);
+            }
+        }
+        if (!y_bus_vec.empty()) {
+            register_parameters_changed_callbacks<sym>();
+            is_parameter_up_to_date<sym>() = true;
+        }
+    }
+
+    template <symmetry_tag sym>
+    static bool is_equal_math_param(MathModelParam<sym> const& x, MathModelParam<sym> const& y) {
+        constexpr auto is_equal = [](ComplexTensor<sym> const& x_value, ComplexTensor<sym> const& y_value) {
+            if constexpr (is_symmetric_v<sym>) {
+                return x_value == y_value;
+            } else {
+                return (x_value == y_value).all();
+            }
+        };
+        auto const is_equal_branch = [is_equal](BranchCalcParam<sym> const& x_branch,
+                                                BranchCalcParam<sym> const& y_branch) {
+            return std::ranges::equal(x_branch.value, y_branch.value, is_equal);
+        };
+        return std::ranges::equal(x.branch_param, y.branch_param, is_equal_branch) &&
+               std::ranges::equal(x.shunt_param, y.shunt_param, is_equal) &&
+               std::ranges::equal(x.source_param, y.source_param, is_equal);
     }
 
     template <symmetry_tag sym> std::vector<MathModelParam<sym>> get_math_param() {
@@ -883,48 +1882,44 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
             math_param[i].source_param.resize(state_.math_topology[i]->n_source());
         }
         // loop all branch
-        for (Idx i = 0; i != static_cast<Idx>(state_.comp_topo->branch_node_idx.size()); ++i) {
+        main_core::for_each_component<Branch>(state_, [this, &math_param](auto const& branch, Idx i) {
             Idx2D const math_idx = state_.topo_comp_coup->branch[i];
             if (math_idx.group == -1) {
-                continue;
+                return;
             }
             // assign parameters
-            math_param[math_idx.group].branch_param[math_idx.pos] =
-                state_.components.template get_item_by_seq<Branch>(i).template calc_param<sym>();
-        }
+            math_param[math_idx.group].branch_param[math_idx.pos] = branch.template calc_param<sym>();
+        });
         // loop all branch3
-        for (Idx i = 0; i != static_cast<Idx>(state_.comp_topo->branch3_node_idx.size()); ++i) {
+        main_core::for_each_component<Branch3>(state_, [this, &math_param](auto const& branch3, Idx i) {
             Idx2DBranch3 const math_idx = state_.topo_comp_coup->branch3[i];
             if (math_idx.group == -1) {
-                continue;
+                return;
             }
             // assign parameters, branch3 param consists of three branch parameters
-            auto const branch3_param =
-                state_.components.template get_item_by_seq<Branch3>(i).template calc_param<sym>();
+            auto const branch3_param = branch3.template calc_param<sym>();
             for (size_t branch2 = 0; branch2 < 3; ++branch2) {
                 math_param[math_idx.group].branch_param[math_idx.pos[branch2]] = branch3_param[branch2];
             }
-        }
+        });
         // loop all shunt
-        for (Idx i = 0; i != static_cast<Idx>(state_.comp_topo->shunt_node_idx.size()); ++i) {
+        main_core::for_each_component<Shunt>(state_, [this, &math_param](Shunt const& shunt, Idx i) {
             Idx2D const math_idx = state_.topo_comp_coup->shunt[i];
             if (math_idx.group == -1) {
-                continue;
+                return;
             }
             // assign parameters
-            math_param[math_idx.group].shunt_param[math_idx.pos] =
-                state_.components.template get_item_by_seq<Shunt>(i).template calc_param<sym>();
-        }
+            math_param[math_idx.group].shunt_param[math_idx.pos] = shunt.template calc_param<sym>();
+        });
         // loop all source
-        for (Idx i = 0; i != static_cast<Idx>(state_.comp_topo->source_node_idx.size()); ++i) {
+        main_core::for_each_component<Source>(state_, [this, &math_param](Source const& source, Idx i) {
             Idx2D const math_idx = state_.topo_comp_coup->source[i];
             if (math_idx.group == -1) {
-                continue;
+                return;
             }
             // assign parameters
-            math_param[math_idx.group].source_param[math_idx.pos] =
-                state_.components.template get_item_by_seq<Source>(i).template math_param<sym>();
-        }
+            math_param[math_idx.group].source_param[math_idx.pos] = source.template math_param<sym>();
+        });
         return math_param;
     }
     template <symmetry_tag sym> std::vector<MathModelParamIncrement> get_math_param_increment() {
@@ -1038,17 +2033,16 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
         requires std::convertible_to<std::invoke_result_t<PredicateIn, Idx>, bool>
     static void prepare_input(MainModelState const& state, std::vector<Idx2D> const& components,
                               std::vector<CalcStructOut>& calc_input, PredicateIn include = include_all) {
-        for (Idx i = 0, n = narrow_cast<Idx>(components.size()); i != n; ++i) {
-            if (include(i)) {
-                Idx2D const math_idx = components[i];
-                if (math_idx.group != -1) {
-                    auto const& component = get_component_by_sequence<ComponentIn>(state, i);
-                    CalcStructOut& math_model_input = calc_input[math_idx.group];
-                    std::vector<CalcParamOut>& math_model_input_vect = math_model_input.*comp_vect;
-                    math_model_input_vect[math_idx.pos] = calculate_param<CalcStructOut>(component);
-                }
+        assert(static_cast<Idx>(components.size()) == main_core::get_component_size<ComponentIn>(state));
+        main_core::for_each_component<ComponentIn>(state, [&components, &calc_input, &include](auto const& component,
+                                                                                              Idx i) {
+            Idx2D const math_idx = components[i];
+            if (math_idx.group != -1 && include(i)) {
+                CalcStructOut& math_model_input = calc_input[math_idx.group];
+                std::vector<CalcParamOut>& math_model_input_vect = math_model_input.*comp_vect;
+                math_model_input_vect[math_idx.pos] = calculate_param<CalcStructOut>(component);
             }
-        }
+        });
     }
 
     template <calculation_input_type CalcStructOut, typename CalcParamOut,
@@ -1058,18 +2052,17 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
     static void prepare_input(MainModelState const& state, std::vector<Idx2D> const& components,
                               std::vector<CalcStructOut>& calc_input,
                               std::invocable<ComponentIn const&> auto extra_args, PredicateIn include = include_all) {
-        for (Idx i = 0, n = narrow_cast<Idx>(components.size()); i != n; ++i) {
-            if (include(i)) {
+        assert(static_cast<Idx>(components.size()) == main_core::get_component_size<ComponentIn>(state));
+        main_core::for_each_component<ComponentIn>(
+            state, [&components, &calc_input, &extra_args, &include](auto const& component, Idx i) {
                 Idx2D const math_idx = components[i];
-                if (math_idx.group != -1) {
-                    auto const& component = get_component_by_sequence<ComponentIn>(state, i);
+                if (math_idx.group != -1 && include(i)) {
                     CalcStructOut& math_model_input = calc_input[math_idx.group];
                     std::vector<CalcParamOut>& math_model_input_vect = math_model_input.*comp_vect;
                     math_model_input_vect[math_idx.pos] =
                         calculate_param<CalcStructOut>(component, extra_args(component));
                 }
-            }
-        }
+            });
     }
 
     template <calculation_input_type CalcInputType>
@@ -1093,14 +2086,12 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
     template <symmetry_tag sym, IntSVector(StateEstimationInput<sym>::*component), class Component>
     static void prepare_input_status(MainModelState const& state, std::vector<Idx2D> const& objects,
                                      std::vector<StateEstimationInput<sym>>& input) {
-        for (Idx i = 0, n = narrow_cast<Idx>(objects.size()); i != n; ++i) {
+        main_core::for_each_component<Component>(state, [&objects, &input](auto const& item, Idx i) {
             Idx2D const math_idx = objects[i];
-            if (math_idx.group == -1) {
-                continue;
+            if (math_idx.group != -1) {
+                (input[math_idx.group].*component)[math_idx.pos] = item.status();
             }
-            (input[math_idx.group].*component)[math_idx.pos] =
-                main_core::get_component_by_sequence<Component>(state, i).status();
-        }
+        });
     }
 
     template <symmetry_tag sym>
@@ -1234,59 +2225,67 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
 
     template <symmetry_tag sym> void prepare_y_bus() {
         std::vector<YBus<sym>>& y_bus_vec = get_y_bus<sym>();
-        // also get the vector of other Y_bus (sym -> asym, or asym -> sym)
-        std::vector<YBus<other_symmetry_t<sym>>>& other_y_bus_vec = get_y_bus<other_symmetry_t<sym>>();
         // If no Ybus exists, build them
         if (y_bus_vec.empty()) {
-            bool const other_y_bus_exist = (!other_y_bus_vec.empty());
             y_bus_vec.reserve(n_math_solvers_);
             auto math_params = get_math_param<sym>();
+            for (Idx i = 0; i != n_math_solvers_; ++i) {
+                add_y_bus<sym>(i, std::move(math_params[i]));
+            }
+        }
+    }
 
-            // Check the branch and shunt indices
-            constexpr auto branch_param_in_seq_map =
-                std::array{index_of_component<Line>, index_of_component<Link>, index_of_component<Transformer>};
-            constexpr auto shunt_param_in_seq_map = std::array{index_of_component<Shunt>};
+    template <symmetry_tag sym> void add_y_bus(Idx math_model_idx, MathModelParam<sym> math_param) {
+        std::vector<YBus<sym>>& y_bus_vec = get_y_bus<sym>();
+        // also get the vector of other Y_bus (sym -> asym, or asym -> sym)
+        std::vector<YBus<other_symmetry_t<sym>>>& other_y_bus_vec = get_y_bus<other_symmetry_t<sym>>();
 
-            for (Idx i = 0; i != n_math_solvers_; ++i) {
-                // construct from existing Y_bus structure if possible
-                if (other_y_bus_exist) {
-                    y_bus_vec.emplace_back(state_.math_topology[i],
-                                           std::make_shared<MathModelParam<sym> const>(std::move(math_params[i])),
-                                           other_y_bus_vec[i].get_y_bus_structure());
-                } else {
-                    y_bus_vec.emplace_back(state_.math_topology[i],
-                                           std::make_shared<MathModelParam<sym> const>(std::move(math_params[i])));
-                }
+        // Check the branch and shunt indices
+        constexpr auto branch_param_in_seq_map =
+            std::array{index_of_component<Line>, index_of_component<Link>, index_of_component<Transformer>};
+        constexpr auto shunt_param_in_seq_map = std::array{index_of_component<Shunt>};
 
-                y_bus_vec.back().set_branch_param_idx(
-                    IdxVector{branch_param_in_seq_map.begin(), branch_param_in_seq_map.end()});
-                y_bus_vec.back().set_shunt_param_idx(
-                    IdxVector{shunt_param_in_seq_map.begin(), shunt_param_in_seq_map.end()});
-            }
+        // construct from existing Y_bus structure if possible
+        if (math_model_idx < static_cast<Idx>(other_y_bus_vec.size())) {
+            y_bus_vec.emplace_back(state_.math_topology[math_model_idx],
+                                   std::make_shared<MathModelParam<sym> const>(std::move(math_param)),
+                                   other_y_bus_vec[math_model_idx].get_y_bus_structure());
+        } else {
+            y_bus_vec.emplace_back(state_.math_topology[math_model_idx],
+                                   std::make_shared<MathModelParam<sym> const>(std::move(math_param)));
         }
+
+        y_bus_vec.back().set_branch_param_idx(
+            IdxVector{branch_param_in_seq_map.begin(), branch_param_in_seq_map.end()});
+        y_bus_vec.back().set_shunt_param_idx(IdxVector{shunt_param_in_seq_map.begin(), shunt_param_in_seq_map.end()});
     }
 
-    template <symmetry_tag sym> void prepare_solvers() {
+    // the math solvers only depend on the topology, the solvers of each method are created at their first calculation
+    template <symmetry_tag sym> void create_solvers() {
         std::vector<MathSolver<sym>>& solvers = get_solvers<sym>();
+        if (n_math_solvers_ == static_cast<Idx>(solvers.size())) {
+            return;
+        }
+        assert(solvers.empty());
+        assert(n_math_solvers_ == static_cast<Idx>(state_.math_topology.size()));
+
+        solvers.reserve(n_math_solvers_);
+        std::ranges::transform(state_.math_topology, std::back_inserter(solvers),
+                               [](auto math_topo) { return MathSolver<sym>{std::move(math_topo)}; });
+    }
+
+    template <symmetry_tag sym> void prepare_solvers() {
         // rebuild topology if needed
         if (!is_topology_up_to_date_) {
             rebuild_topology();
         }
+        bool const is_new_y_bus = get_y_bus<sym>().empty();
         prepare_y_bus<sym>();
+        // the math solvers may already be created by the observability check
+        create_solvers<sym>();
 
-        if (n_math_solvers_ != static_cast<Idx>(solvers.size())) {
-            assert(solvers.empty());
-            assert(n_math_solvers_ == static_cast<Idx>(state_.math_topology.size()));
-            assert(n_math_solvers_ == static_cast<Idx>(get_y_bus<sym>().size()));
-
-            solvers.clear();
-            solvers.reserve(n_math_solvers_);
-            std::ranges::transform(state_.math_topology, std::back_inserter(solvers),
-                                   [](auto math_topo) { return MathSolver<sym>{std::move(math_topo)}; });
-            for (Idx idx = 0; idx < n_math_solvers_; ++idx) {
-                get_y_bus<sym>()[idx].register_parameters_changed_callback(
-                    [solver = std::ref(solvers[idx])](bool changed) { solver.get().parameters_changed(changed); });
-            }
+        if (is_new_y_bus) {
+            register_parameters_changed_callbacks<sym>();
         } else if (!is_parameter_up_to_date<sym>()) {
             std::vector<MathModelParam<sym>> const math_params = get_math_param<sym>();
             std::vector<MathModelParamIncrement> const math_param_increments = get_math_param_increment<sym>();
@@ -1301,6 +2300,20 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
         std::ranges::for_each(parameter_changed_components_, [](auto& comps) { comps.clear(); });
         last_updated_calculation_symmetry_mode_ = is_symmetric_v<sym>;
     }
+
+    // the Y bus of each math model signals its parameter changes to the solver of the same math model
+    template <symmetry_tag sym> void register_parameters_changed_callbacks() {
+        std::vector<MathSolver<sym>>& solvers = get_solvers<sym>();
+        std::vector<YBus<sym>>& y_bus_vec = get_y_bus<sym>();
+        assert(n_math_solvers_ == static_cast<Idx>(y_bus_vec.size()));
+        assert(n_math_solvers_ == static_cast<Idx>(solvers.size()));
+        for (Idx idx = 0; idx < n_math_solvers_; ++idx) {
+            // a reused Y bus still refers to the solver before it was moved
+            y_bus_vec[idx].clear_parameters_changed_callbacks();
+            y_bus_vec[idx].register_parameters_changed_callback(
+                [solver = std::ref(solvers[idx])](bool changed) { solver.get().parameters_changed(changed); });
+        }
+    }
 };
 
 using MainModel =
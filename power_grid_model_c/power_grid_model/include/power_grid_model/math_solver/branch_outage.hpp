@@ -0,0 +1,122 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+/*
+Outage of branches in an existing math model
+
+Switching off a branch removes its admittance from the Y bus:
+    YBus' = YBus - P * Y_branch * P^T
+where P selects the buses of the branch.
+This is a low-rank change of the base case matrix, which can be solved by compensation
+on the base case factorization, as long as the island structure of the math model does not change.
+
+The internal bus of an outaged three-winding transformer is dropped from the math model together with its branches.
+To keep the matrix non-singular, an identity is put on its diagonal instead, which results in zero voltage.
+*/
+
+#include "low_rank_change.hpp"
+#include "y_bus.hpp"
+
+#include "../calculation_parameters.hpp"
+#include "../common/common.hpp"
+#include "../common/three_phase_tensor.hpp"
+
+#include <algorithm>
+#include <deque>
+
+namespace power_grid_model::math_solver {
+
+struct BranchOutage {
+    IdxVector branches;      // positions of the outaged branches in the math model
+    IdxVector dropped_buses; // internal buses of outaged three-winding transformers
+};
+
+// check if all buses, except the dropped ones, are still connected to a source after the outage
+inline bool is_island_preserved(MathModelTopology const& topo, BranchOutage const& outage) {
+    Idx const n_bus = topo.n_bus();
+    std::vector<IdxVector> neighbours(n_bus);
+    for (Idx branch = 0; branch != topo.n_branch(); ++branch) {
+        auto const [f, t] = topo.branch_bus_idx[branch];
+        if (f == -1 || t == -1 || std::ranges::find(outage.branches, branch) != outage.branches.cend()) {
+            continue;
+        }
+        neighbours[f].push_back(t);
+        neighbours[t].push_back(f);
+    }
+
+    std::vector<bool> reached(n_bus, false);
+    std::deque<Idx> to_visit;
+    for (auto const& [bus, sources] : enumerated_zip_sequence(topo.sources_per_bus)) {
+        if (!sources.empty() && !reached[bus]) {
+            reached[bus] = true;
+            to_visit.push_back(bus);
+        }
+    }
+    while (!to_visit.empty()) {
+        Idx const bus = to_visit.front();
+        to_visit.pop_front();
+        for (Idx const neighbour : neighbours[bus]) {
+            if (!reached[neighbour]) {
+                reached[neighbour] = true;
+                to_visit.push_back(neighbour);
+            }
+        }
+    }
+
+    for (Idx bus = 0; bus != n_bus; ++bus) {
+        bool const is_dropped = std::ranges::find(outage.dropped_buses, bus) != outage.dropped_buses.cend();
+        if (reached[bus] == is_dropped) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// add the change of the Y bus by the outage, to be used for compensation
+template <symmetry_tag sym>
+inline void add_outage_change(YBus<sym> const& y_bus, BranchOutage const& outage, LowRankChange<sym>& change) {
+    auto const& topo = y_bus.math_topology();
+    auto const& branch_param = y_bus.math_model_param().branch_param;
+    for (Idx const branch : outage.branches) {
+        auto const [f, t] = topo.branch_bus_idx[branch];
+        BranchCalcParam<sym> const& param = branch_param[branch];
+        if (f != -1) {
+            change.add(f, f, -param.yff());
+        }
+        if (t != -1) {
+            change.add(t, t, -param.ytt());
+        }
+        if (f != -1 && t != -1) {
+            change.add(f, t, -param.yft());
+            change.add(t, f, -param.ytf());
+        }
+    }
+    for (Idx const bus : outage.dropped_buses) {
+        change.add(bus, bus, ComplexTensor<sym>{1.0});
+    }
+}
+
+// remove the flows of the outaged branches from a result calculated with the base case Y bus
+template <symmetry_tag sym> inline void remove_outaged_branch_flows(YBus<sym> const& y_bus, BranchOutage const& outage,
+                                                                     SolverOutput<sym>& output) {
+    auto const& topo = y_bus.math_topology();
+    for (Idx const branch : outage.branches) {
+        auto const [f, t] = topo.branch_bus_idx[branch];
+        BranchSolverOutput<sym>& flow = output.branch[branch];
+        if (f != -1) {
+            output.bus_injection[f] -= flow.s_f;
+        }
+        if (t != -1) {
+            output.bus_injection[t] -= flow.s_t;
+        }
+        flow = BranchSolverOutput<sym>{};
+    }
+    for (Idx const bus : outage.dropped_buses) {
+        output.bus_injection[bus] = ComplexValue<sym>{};
+    }
+}
+
+} // namespace power_grid_model::math_solver
@@ -17,9 +17,12 @@ Prefactorization:
     If the Y bus matrix does not change, then there is no need for factorizing it again to solve linear equations.
     Hence it is done only once in the first iteration and same result is used in subsequent iterations.
     Same factorization is also used in subsequent batches
+    For asymmetric calculation of a balanced network, the sequence networks are factorized and solved separately.
+        See sequence_decoupled_solver.hpp
 
 Steps:
     Initialize U with averaged u_ref, ie source voltage and phase shifts accounted
+        or with the initial voltage of the input, if given (warm start)
     Initialize solver
     while maximum deviation > error tolerance
         Calculate I_inj with U of previous iteration as per load/gen types.
@@ -55,6 +58,7 @@ Nomenclature:
 #include "block_matrix.hpp"
 #include "common_solver_functions.hpp"
 #include "iterative_pf_solver.hpp"
+#include "sequence_decoupled_solver.hpp"
 #include "sparse_lu_solver.hpp"
 #include "y_bus.hpp"
 
@@ -84,7 +88,13 @@ class IterativeCurrentPFSolver : public IterativePFSolver<sym, IterativeCurrentP
     // Add source admittance to Y bus and set variable for prepared y bus to true
     void initialize_derived_solver(YBus<sym> const& y_bus, PowerFlowInput<sym> const& input,
                                    SolverOutput<sym>& output) {
-        make_flat_start(input, output.u);
+        if (input.initial_u.empty()) {
+            make_flat_start(input, output.u);
+        } else {
+            // warm start
+            assert(static_cast<Idx>(input.initial_u.size()) == this->n_bus_);
+            output.u = input.initial_u;
+        }
 
         auto const& sources_per_bus = *this->sources_per_bus_;
         IdxVector const& bus_entry = y_bus.lu_diag();
@@ -101,6 +111,17 @@ class IterativeCurrentPFSolver : public IterativePFSolver<sym, IterativeCurrentP
                     mat_data[data_sequence] += y_bus.math_model_param().source_param[source_number];
                 }
             }
+            // use the decoupled sequence networks if the network is balanced
+            if constexpr (is_asymmetric_v<sym>) {
+                if (auto sequence_solver = SequenceDecoupledSolver::factorize(y_bus, mat_data);
+                    sequence_solver.has_value()) {
+                    sequence_solver_ =
+                        std::make_shared<SequenceDecoupledSolver const>(std::move(sequence_solver).value());
+                    parameters_changed_ = false;
+                    return;
+                }
+                sequence_solver_.reset();
+            }
             // prefactorize
             BlockPermArray perm(this->n_bus_);
             sparse_solver_.prefactorize(mat_data, perm);
@@ -129,7 +150,15 @@ class IterativeCurrentPFSolver : public IterativePFSolver<sym, IterativeCurrentP
 
     // Solve the linear equations I_inj = YU
     // inplace
-    void solve_matrix() { sparse_solver_.solve_with_prefactorized_matrix(*mat_data_, *perm_, rhs_u_, rhs_u_); }
+    void solve_matrix() {
+        if constexpr (is_asymmetric_v<sym>) {
+            if (sequence_solver_) {
+                sequence_solver_->solve(rhs_u_, rhs_u_);
+                return;
+            }
+        }
+        sparse_solver_.solve_with_prefactorized_matrix(*mat_data_, *perm_, rhs_u_, rhs_u_);
+    }
 
     // Find maximum deviation in voltage among all buses
     double iterate_unknown(ComplexValueVector<sym>& u) {
@@ -154,6 +183,8 @@ class IterativeCurrentPFSolver : public IterativePFSolver<sym, IterativeCurrentP
     // sparse solver
     SparseSolverType sparse_solver_;
     std::shared_ptr<BlockPermArray const> perm_;
+    // factorized sequence networks, only set for asymmetric calculation of a balanced network
+    std::shared_ptr<SequenceDecoupledSolver const> sequence_solver_;
     bool parameters_changed_ = true;
 
     void add_loads(boost::iterator_range<IdxCount> const& load_gens, Idx bus_number, PowerFlowInput<sym> const& input,
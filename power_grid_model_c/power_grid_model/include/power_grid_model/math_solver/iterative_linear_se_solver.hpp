@@ -19,6 +19,8 @@
 #include "../common/three_phase_tensor.hpp"
 #include "../common/timer.hpp"
 
+#include <algorithm>
+
 namespace power_grid_model::math_solver {
 
 // hide implementation in inside namespace
@@ -69,12 +71,14 @@ template <symmetry_tag sym> class IterativeLinearSESolver {
     IterativeLinearSESolver(YBus<sym> const& y_bus, std::shared_ptr<MathModelTopology const> topo_ptr)
         : n_bus_{y_bus.size()},
           math_topo_{std::move(topo_ptr)},
+          gain_(y_bus.nnz_lu()),
           data_gain_(y_bus.nnz_lu()),
           x_rhs_(y_bus.size()),
           sparse_solver_{y_bus.shared_indptr_lu(), y_bus.shared_indices_lu(), y_bus.shared_diag_lu()},
           perm_(y_bus.size()) {}
 
-    SolverOutput<sym> run_state_estimation(YBus<sym> const& y_bus, StateEstimationInput<sym> const& input,
+    // the measured values are kept by the caller, so that the sensor mapping is reused across runs
+    SolverOutput<sym> run_state_estimation(YBus<sym> const& y_bus, MeasuredValues<sym> const& measured_values,
                                            double err_tol, Idx max_iter, CalculationInfo& calculation_info) {
         // prepare
         Timer main_timer;
@@ -86,14 +90,10 @@ template <symmetry_tag sym> class IterativeLinearSESolver {
 
         main_timer = Timer(calculation_info, 2220, "Math solver");
 
-        // preprocess measured value
-        sub_timer = Timer(calculation_info, 2221, "Pre-process measured value");
-        MeasuredValues<sym> const measured_values{y_bus.shared_topology(), input};
-        necessary_observability_check(measured_values, y_bus.shared_topology());
-
-        // prepare matrix, including pre-factorization
+        // prepare matrix, including pre-factorization if the gain matrix changed
         sub_timer = Timer(calculation_info, 2222, "Prepare matrix, including pre-factorization");
         prepare_matrix(y_bus, measured_values);
+        prefactorize_if_changed();
 
         // initialize voltage with initial angle
         sub_timer = Timer(calculation_info, 2223, "Initialize voltages");
@@ -142,6 +142,11 @@ template <symmetry_tag sym> class IterativeLinearSESolver {
     std::shared_ptr<MathModelTopology const> math_topo_;
 
     // data for gain matrix
+    //    the gain matrix only depends on the parameters, the sensor presence and the variances,
+    //    not on the measured values, so the factorization can be reused if the gain matrix does not change
+    std::vector<ILSEGainBlock<sym>> gain_;
+    std::vector<ILSEGainBlock<sym>> factorized_gain_;
+    // factorized gain matrix
     std::vector<ILSEGainBlock<sym>> data_gain_;
     // unknown and rhs
     std::vector<ILSERhs<sym>> x_rhs_;
@@ -163,7 +168,7 @@ template <symmetry_tag sym> class IterativeLinearSESolver {
             for (Idx data_idx_lu = row_indptr[row]; data_idx_lu != row_indptr[row + 1]; ++data_idx_lu) {
                 Idx const col = col_indices[data_idx_lu];
                 // get a reference and reset block to zero
-                ILSEGainBlock<sym>& block = data_gain_[data_idx_lu];
+                ILSEGainBlock<sym>& block = gain_[data_idx_lu];
                 block.clear();
                 // get data idx of y bus,
                 // skip for a fill-in
@@ -244,10 +249,21 @@ template <symmetry_tag sym> class IterativeLinearSESolver {
                 continue;
             }
             Idx const data_idx_tranpose = y_bus.lu_transpose_entry()[data_idx_lu];
-            data_gain_[data_idx_lu].qh() = hermitian_transpose(data_gain_[data_idx_tranpose].q());
+            gain_[data_idx_lu].qh() = hermitian_transpose(gain_[data_idx_tranpose].q());
+        }
+    }
+
+    void prefactorize_if_changed() {
+        auto const same_block = [](ILSEGainBlock<sym> const& x, ILSEGainBlock<sym> const& y) {
+            return (x == y).all();
+        };
+        if (std::ranges::equal(gain_, factorized_gain_, same_block)) {
+            return;
         }
-        // prefactorize
+        factorized_gain_.clear();
+        data_gain_ = gain_;
         sparse_solver_.prefactorize(data_gain_, perm_);
+        factorized_gain_ = gain_;
     }
 
     void prepare_rhs(YBus<sym> const& y_bus, MeasuredValues<sym> const& measured_value,
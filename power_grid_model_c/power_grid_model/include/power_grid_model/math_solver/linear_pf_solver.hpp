@@ -28,7 +28,9 @@ if there are sources
 
 */
 
+#include "branch_outage.hpp"
 #include "common_solver_functions.hpp"
+#include "low_rank_change.hpp"
 #include "sparse_lu_solver.hpp"
 #include "y_bus.hpp"
 
@@ -38,6 +40,10 @@ if there are sources
 #include "../common/three_phase_tensor.hpp"
 #include "../common/timer.hpp"
 
+#include <algorithm>
+#include <optional>
+#include <utility>
+
 namespace power_grid_model::math_solver {
 
 namespace linear_pf {
@@ -49,11 +55,17 @@ template <symmetry_tag sym> class LinearPFSolver {
     using BlockPermArray =
         typename SparseLUSolver<ComplexTensor<sym>, ComplexValue<sym>, ComplexValue<sym>>::BlockPermArray;
 
+    // the factorization is reused when the matrix changes in only a few buses,
+    //    if the number of changed buses is at most max_low_rank_ports and at most 1 / low_rank_ratio of the buses
+    static constexpr Idx max_low_rank_ports = 8;
+    static constexpr Idx low_rank_ratio = 4;
+
     LinearPFSolver(YBus<sym> const& y_bus, std::shared_ptr<MathModelTopology const> const& topo_ptr)
         : n_bus_{y_bus.size()},
           load_gens_per_bus_{topo_ptr, &topo_ptr->load_gens_per_bus},
           sources_per_bus_{topo_ptr, &topo_ptr->sources_per_bus},
           mat_data_(y_bus.nnz_lu()),
+          lu_data_(y_bus.nnz_lu()),
           sparse_solver_{y_bus.shared_indptr_lu(), y_bus.shared_indices_lu(), y_bus.shared_diag_lu()},
           perm_(n_bus_) {}
 
@@ -67,13 +79,20 @@ template <symmetry_tag sym> class LinearPFSolver {
 
         // prepare matrix
         Timer sub_timer(calculation_info, 2221, "Prepare matrix");
-        detail::copy_y_bus<sym>(y_bus, mat_data_);
         prepare_matrix_and_rhs(y_bus, input, output);
 
         // solve
         // u vector will have I_injection for slack bus for now
-        sub_timer = Timer(calculation_info, 2222, "Solve sparse linear equation");
-        sparse_solver_.prefactorize_and_solve(mat_data_, perm_, output.u, output.u);
+        bool solved{false};
+        if (auto const change = factorization_change(y_bus); change.has_value()) {
+            sub_timer = Timer(calculation_info, 2224, "Solve by low-rank update");
+            solved = solve_by_low_rank_update(change.value(), output.u);
+        }
+        if (!solved) {
+            sub_timer = Timer(calculation_info, 2222, "Solve sparse linear equation");
+            factorize();
+            sparse_solver_.solve_with_prefactorized_matrix(lu_data_, perm_, output.u, output.u);
+        }
 
         // calculate math result
         sub_timer = Timer(calculation_info, 2223, "Calculate math result");
@@ -83,19 +102,88 @@ template <symmetry_tag sym> class LinearPFSolver {
         return output;
     }
 
+    // power flow with some branches switched off, without refactorizing the matrix
+    // the factorization of a previous power flow is reused if the matrix changed in only a few buses
+    SolverOutput<sym> run_power_flow_with_outage(YBus<sym> const& y_bus, PowerFlowInput<sym> const& input,
+                                                 BranchOutage const& outage, CalculationInfo& calculation_info) {
+        SolverOutput<sym> output;
+        output.u.resize(n_bus_);
+
+        Timer const main_timer(calculation_info, 2230, "Math solver with outage");
+
+        Timer sub_timer(calculation_info, 2231, "Prepare matrix");
+        prepare_matrix_and_rhs(y_bus, input, output);
+        auto change = factorization_change(y_bus);
+        if (!change.has_value()) {
+            factorize();
+            change.emplace(n_bus_);
+        }
+        add_outage_change(y_bus, outage, change.value());
+
+        sub_timer = Timer(calculation_info, 2232, "Solve by compensation");
+        sparse_solver_.solve_with_low_rank_update(lu_data_, perm_, change->ports(), change->delta(), output.u,
+                                                  output.u);
+
+        sub_timer = Timer(calculation_info, 2233, "Calculate math result");
+        calculate_result(y_bus, input, output);
+        remove_outaged_branch_flows(y_bus, outage, output);
+
+        return output;
+    }
+
   private:
     Idx n_bus_;
     // shared topo data
     std::shared_ptr<SparseGroupedIdxVector const> load_gens_per_bus_;
     std::shared_ptr<DenseGroupedIdxVector const> sources_per_bus_;
     // sparse linear equation
+    //    the prepared matrix, reused between the runs, and the LU factors of the current factorization
+    //    the unfactorized matrix of the current factorization is kept to find the change of a newly prepared matrix,
+    //    only if a low-rank update is possible for the number of buses
     ComplexTensorVector<sym> mat_data_;
+    ComplexTensorVector<sym> lu_data_;
+    ComplexTensorVector<sym> factorized_mat_data_;
+    bool factorized_{false};
     // sparse solver
     SparseSolverType sparse_solver_;
     BlockPermArray perm_;
 
+    Idx max_ports() const { return std::min(max_low_rank_ports, n_bus_ / low_rank_ratio); }
+
+    void factorize() {
+        factorized_ = false;
+        lu_data_ = mat_data_;
+        sparse_solver_.prefactorize(lu_data_, perm_);
+        if (max_ports() > 0) {
+            // the prepared matrix is overwritten by the next run, so the buffers are swapped instead of copied
+            std::swap(factorized_mat_data_, mat_data_);
+        }
+        factorized_ = true;
+    }
+
+    // low-rank change of the prepared matrix with respect to the factorized matrix, if any
+    std::optional<LowRankChange<sym>> factorization_change(YBus<sym> const& y_bus) const {
+        if (!factorized_ || max_ports() == 0) {
+            return std::nullopt;
+        }
+        return matrix_change(y_bus, factorized_mat_data_, mat_data_, max_ports());
+    }
+
+    // returns false if the compensation is singular, the matrix should be refactorized in that case
+    bool solve_by_low_rank_update(LowRankChange<sym> const& change, ComplexValueVector<sym>& u) {
+        try {
+            sparse_solver_.solve_with_low_rank_update(lu_data_, perm_, change.ports(), change.delta(), u, u);
+        } catch (SparseMatrixError const&) {
+            return false;
+        }
+        return true;
+    }
+
     void prepare_matrix_and_rhs(YBus<sym> const& y_bus, PowerFlowInput<sym> const& input, SolverOutput<sym>& output) {
-        detail::prepare_linear_matrix_and_rhs(y_bus, input, *load_gens_per_bus_, *sources_per_bus_, output, mat_data_);
+        mat_data_.resize(y_bus.nnz_lu());
+        detail::copy_y_bus<sym>(y_bus, mat_data_);
+        detail::prepare_linear_matrix_and_rhs(y_bus, input, *load_gens_per_bus_, *sources_per_bus_, output,
+                                              mat_data_);
     }
 
     void calculate_result(YBus<sym> const& y_bus, PowerFlowInput<sym> const& input, SolverOutput<sym>& output) {
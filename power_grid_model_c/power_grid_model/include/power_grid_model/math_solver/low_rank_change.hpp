@@ -0,0 +1,109 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+/*
+Low-rank change of a block sparse matrix in the LU structure of the Y bus
+
+The change is expressed as
+    A' = A + P * D * P^T
+where P selects the buses (ports) involved in the change and D is a dense matrix between the ports.
+If the number of ports is small, A' can be solved by compensation on the factorization of A,
+    see SparseLUSolver::solve_with_low_rank_update.
+*/
+
+#include "y_bus.hpp"
+
+#include "../common/common.hpp"
+#include "../common/three_phase_tensor.hpp"
+
+#include <Eigen/Dense>
+
+#include <optional>
+
+namespace power_grid_model::math_solver {
+
+template <symmetry_tag sym> class LowRankChange {
+  public:
+    static constexpr Idx block_size = is_symmetric_v<sym> ? 1 : 3;
+    using DenseMatrix = Eigen::Matrix<DoubleComplex, Eigen::Dynamic, Eigen::Dynamic>;
+
+    explicit LowRankChange(Idx n_bus) : bus_ports_(n_bus, -1) {}
+
+    IdxVector const& ports() const { return ports_; }
+    Idx n_ports() const { return static_cast<Idx>(ports_.size()); }
+    bool empty() const { return ports_.empty(); }
+
+    // add value to the block (row_bus, col_bus) of the change
+    void add(Idx row_bus, Idx col_bus, ComplexTensor<sym> const& value) {
+        entries_.push_back({.row_port = port_of(row_bus), .col_port = port_of(col_bus), .value = value});
+    }
+
+    // dense change D between the ports, with block_size * n_ports() rows and columns
+    DenseMatrix delta() const {
+        Idx const rank = block_size * n_ports();
+        DenseMatrix result = DenseMatrix::Zero(rank, rank);
+        for (auto const& [row_port, col_port, value] : entries_) {
+            if constexpr (is_symmetric_v<sym>) {
+                result(row_port, col_port) += value;
+            } else {
+                result.block(row_port * block_size, col_port * block_size, block_size, block_size) += value.matrix();
+            }
+        }
+        return result;
+    }
+
+  private:
+    struct Entry {
+        Idx row_port;
+        Idx col_port;
+        ComplexTensor<sym> value;
+    };
+
+    IdxVector ports_;
+    // port of each bus, -1 if the bus is not a port
+    IdxVector bus_ports_;
+    std::vector<Entry> entries_;
+
+    Idx port_of(Idx bus) {
+        Idx& port = bus_ports_[bus];
+        if (port == -1) {
+            port = n_ports();
+            ports_.push_back(bus);
+        }
+        return port;
+    }
+};
+
+// change between two matrices with the LU structure of the Y bus
+//    the cost is at most linear in the number of non-zeros, which is much cheaper than a factorization
+//    return nullopt as soon as the change involves more than max_ports buses
+template <symmetry_tag sym>
+std::optional<LowRankChange<sym>> matrix_change(YBus<sym> const& y_bus, ComplexTensorVector<sym> const& base,
+                                                ComplexTensorVector<sym> const& matrix, Idx max_ports) {
+    auto const& row_indptr = y_bus.row_indptr_lu();
+    auto const& col_indices = y_bus.col_indices_lu();
+    LowRankChange<sym> change{y_bus.size()};
+    for (Idx row = 0; row != y_bus.size(); ++row) {
+        for (Idx entry = row_indptr[row]; entry != row_indptr[row + 1]; ++entry) {
+            ComplexTensor<sym> const difference = matrix[entry] - base[entry];
+            bool changed{};
+            if constexpr (is_symmetric_v<sym>) {
+                changed = difference != 0.0;
+            } else {
+                changed = (difference != 0.0).any();
+            }
+            if (changed) {
+                change.add(row, col_indices[entry], difference);
+                if (change.n_ports() > max_ports) {
+                    return std::nullopt;
+                }
+            }
+        }
+    }
+    return change;
+}
+
+} // namespace power_grid_model::math_solver
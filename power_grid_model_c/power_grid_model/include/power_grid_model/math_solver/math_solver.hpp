@@ -7,8 +7,10 @@
 #include "iterative_current_pf_solver.hpp"
 #include "iterative_linear_se_solver.hpp"
 #include "linear_pf_solver.hpp"
+#include "measured_values.hpp"
 #include "newton_raphson_pf_solver.hpp"
 #include "newton_raphson_se_solver.hpp"
+#include "observability.hpp"
 #include "short_circuit_solver.hpp"
 #include "y_bus.hpp"
 
@@ -55,23 +57,46 @@ template <symmetry_tag sym> class MathSolver {
         }
     }
 
+    // linear power flow with some branches switched off, solved by compensation on the base case factorization
+    //    the outage should preserve the island structure, see is_island_preserved
+    SolverOutput<sym> run_power_flow_with_outage(PowerFlowInput<sym> const& input, BranchOutage const& outage,
+                                                 CalculationInfo& calculation_info, YBus<sym> const& y_bus) {
+        if (!linear_pf_solver_.has_value()) {
+            Timer const timer(calculation_info, 2210, "Create math solver");
+            linear_pf_solver_.emplace(y_bus, topo_ptr_);
+        }
+        return linear_pf_solver_.value().run_power_flow_with_outage(y_bus, input, outage, calculation_info);
+    }
+
+    // if is_observability_checked, check_observability was called with the same input directly before,
+    //    so the measured values are not refreshed again
     SolverOutput<sym> run_state_estimation(StateEstimationInput<sym> const& input, double err_tol, Idx max_iter,
                                            CalculationInfo& calculation_info, CalculationMethod calculation_method,
-                                           YBus<sym> const& y_bus) {
+                                           YBus<sym> const& y_bus, bool is_observability_checked = false) {
         using enum CalculationMethod;
 
         switch (calculation_method) {
         case default_method:
             [[fallthrough]]; // use iterative linear by default
         case iterative_linear:
-            return run_state_estimation_iterative_linear(input, err_tol, max_iter, calculation_info, y_bus);
+            return run_state_estimation_iterative_linear(input, err_tol, max_iter, calculation_info, y_bus,
+                                                         is_observability_checked);
         case newton_raphson:
-            return run_state_estimation_newton_raphson(input, err_tol, max_iter, calculation_info, y_bus);
+            return run_state_estimation_newton_raphson(input, err_tol, max_iter, calculation_info, y_bus,
+                                                       is_observability_checked);
         default:
             throw InvalidCalculationMethod{};
         }
     }
 
+    // check the observability of the state estimation input without solving it, throw NotObservableError if not
+    //    the check only needs the topology, so it can be done before the state estimation solvers are created
+    //    the refreshed measured values are kept in the math solver, see run_state_estimation
+    void check_observability(StateEstimationInput<sym> const& input, CalculationInfo& calculation_info) {
+        Timer const timer(calculation_info, 2221, "Pre-process measured value");
+        refresh_observable_measured_values(measured_values_, is_observable_, topo_ptr_, input);
+    }
+
     ShortCircuitSolverOutput<sym> run_short_circuit(ShortCircuitInput const& input, CalculationInfo& calculation_info,
                                                     CalculationMethod calculation_method, YBus<sym> const& y_bus) {
         if (calculation_method != CalculationMethod::default_method &&
@@ -89,6 +114,26 @@ template <symmetry_tag sym> class MathSolver {
         return iec60909_sc_solver_.value().run_short_circuit(y_bus, input);
     }
 
+    // every fault is calculated independently on the same factorization, see ShortCircuitSolver::run_fault_sweep
+    ShortCircuitSolverOutput<sym> run_short_circuit_sweep(ShortCircuitInput const& input,
+                                                          CalculationInfo& calculation_info,
+                                                          CalculationMethod calculation_method,
+                                                          YBus<sym> const& y_bus) {
+        if (calculation_method != CalculationMethod::default_method &&
+            calculation_method != CalculationMethod::iec60909) {
+            throw InvalidCalculationMethod{};
+        }
+
+        // construct model if needed
+        if (!iec60909_sc_solver_.has_value()) {
+            Timer const timer(calculation_info, 2210, "Create math solver");
+            iec60909_sc_solver_.emplace(y_bus, topo_ptr_);
+        }
+
+        // call calculation
+        return iec60909_sc_solver_.value().run_fault_sweep(y_bus, input);
+    }
+
     void clear_solver() {
         newton_raphson_pf_solver_.reset();
         linear_pf_solver_.reset();
@@ -111,6 +156,12 @@ template <symmetry_tag sym> class MathSolver {
     std::optional<IterativeLinearSESolver<sym>> iterative_linear_se_solver_;
     std::optional<NewtonRaphsonSESolver<sym>> newton_raphson_se_solver_;
     std::optional<ShortCircuitSolver<sym>> iec60909_sc_solver_;
+    // measured values of the previous state estimation, shared by the methods
+    //    the sensor mapping is reused as long as the sensor configuration does not change
+    std::optional<MeasuredValues<sym>> measured_values_;
+    // whether measured_values_ is observable, see observability.hpp
+    //    only checked again if the sensor configuration changed
+    bool is_observable_{};
 
     SolverOutput<sym> run_power_flow_newton_raphson(PowerFlowInput<sym> const& input, double err_tol, Idx max_iter,
                                                     CalculationInfo& calculation_info, YBus<sym> const& y_bus) {
@@ -148,7 +199,11 @@ template <symmetry_tag sym> class MathSolver {
 
     SolverOutput<sym> run_state_estimation_iterative_linear(StateEstimationInput<sym> const& input, double err_tol,
                                                             Idx max_iter, CalculationInfo& calculation_info,
-                                                            YBus<sym> const& y_bus) {
+                                                            YBus<sym> const& y_bus, bool is_observability_checked) {
+        // check the observability first, so that no solver is created for an unobservable input
+        MeasuredValues<sym> const& measured_values =
+            observable_measured_values(input, calculation_info, is_observability_checked);
+
         // construct model if needed
         if (!iterative_linear_se_solver_.has_value()) {
             Timer const timer(calculation_info, 2210, "Create math solver");
@@ -156,13 +211,17 @@ template <symmetry_tag sym> class MathSolver {
         }
 
         // call calculation
-        return iterative_linear_se_solver_.value().run_state_estimation(y_bus, input, err_tol, max_iter,
+        return iterative_linear_se_solver_.value().run_state_estimation(y_bus, measured_values, err_tol, max_iter,
                                                                         calculation_info);
     }
 
     SolverOutput<sym> run_state_estimation_newton_raphson(StateEstimationInput<sym> const& input, double err_tol,
                                                           Idx max_iter, CalculationInfo& calculation_info,
-                                                          YBus<sym> const& y_bus) {
+                                                          YBus<sym> const& y_bus, bool is_observability_checked) {
+        // check the observability first, so that no solver is created for an unobservable input
+        MeasuredValues<sym> const& measured_values =
+            observable_measured_values(input, calculation_info, is_observability_checked);
+
         // construct model if needed
         if (!newton_raphson_se_solver_.has_value()) {
             Timer const timer(calculation_info, 2210, "Create math solver");
@@ -170,9 +229,19 @@ template <symmetry_tag sym> class MathSolver {
         }
 
         // call calculation
-        return newton_raphson_se_solver_.value().run_state_estimation(y_bus, input, err_tol, max_iter,
+        return newton_raphson_se_solver_.value().run_state_estimation(y_bus, measured_values, err_tol, max_iter,
                                                                       calculation_info);
     }
+
+    MeasuredValues<sym> const& observable_measured_values(StateEstimationInput<sym> const& input,
+                                                          CalculationInfo& calculation_info,
+                                                          bool is_observability_checked) {
+        if (!is_observability_checked) {
+            check_observability(input, calculation_info);
+        }
+        assert(measured_values_.has_value());
+        return measured_values_.value();
+    }
 };
 
 template class MathSolver<symmetric_t>;
@@ -12,6 +12,8 @@ Collect all measured Values
 #include "../common/three_phase_tensor.hpp"
 
 #include <memory>
+#include <optional>
+#include <utility>
 
 namespace power_grid_model::math_solver {
 
@@ -66,6 +68,22 @@ template <symmetry_tag sym> class MeasuredValues {
         normalize_variance();
     }
 
+    // refresh the measured values and variances with a new input of the same sensor configuration
+    //    the mapping of the sensors to the buses, branches and appliances is reused,
+    //    only the measurements are read and combined again
+    // the sensor configuration is the same if the appliance statuses are the same, and the same voltage sensors and
+    //    appliance sensors have a finite variance, so that the same quantities are measured
+    //    the voltage angle should also be measured at the same buses
+    // returns false if the sensor configuration is different, the measured values should then be constructed again
+    bool refresh(StateEstimationInput<sym> const& input) {
+        if (!refresh_voltage_measurements(input) || !refresh_appliance_measurements(input)) {
+            return false;
+        }
+        refresh_branch_measurements(input);
+        normalize_variance();
+        return true;
+    }
+
     constexpr bool has_angle() const { return n_voltage_angle_measurements_ > 0; }
     constexpr bool has_voltage_measurements() const { return n_voltage_measurements_ > 0; }
 
@@ -265,19 +283,7 @@ template <symmetry_tag sym> class MeasuredValues {
                                                     StateEstimationInput<sym> const& input) {
         RealValue<sym> angle_cum{};
 
-        VoltageSensorCalcParam<sym> aggregated{ComplexValue<sym>{0.0}, std::numeric_limits<double>::infinity()};
-        bool angle_measured{false};
-
-        // check if there is nan
-        if (auto const start = input.measured_voltage.cbegin() + *sensors.begin();
-            std::any_of(start, start + sensors.size(), [](auto const& x) { return is_nan(imag(x.value)); })) {
-            // only keep magnitude
-            aggregated = combine_measurements<true>(input.measured_voltage, sensors);
-        } else {
-            // keep complex number
-            aggregated = combine_measurements(input.measured_voltage, sensors);
-            angle_measured = true;
-        }
+        auto const [aggregated, angle_measured] = combine_voltage_measurements(input, sensors);
 
         if (is_inf(aggregated.variance)) {
             idx_voltage_[bus] = unmeasured;
@@ -293,6 +299,19 @@ template <symmetry_tag sym> class MeasuredValues {
         return angle_cum;
     }
 
+    // combine the voltage measurements of a bus, the angle is only kept if all sensors measure the angle
+    static std::pair<VoltageSensorCalcParam<sym>, bool>
+    combine_voltage_measurements(StateEstimationInput<sym> const& input, IdxRange const& sensors) {
+        // check if there is nan
+        if (auto const start = input.measured_voltage.cbegin() + *sensors.begin();
+            std::any_of(start, start + sensors.size(), [](auto const& x) { return is_nan(imag(x.value)); })) {
+            // only keep magnitude
+            return {combine_measurements<true>(input.measured_voltage, sensors), false};
+        }
+        // keep complex number
+        return {combine_measurements(input.measured_voltage, sensors), true};
+    }
+
     void process_appliance_measurements(StateEstimationInput<sym> const& input) {
         MathModelTopology const& topo = math_topology();
 
@@ -311,6 +330,28 @@ template <symmetry_tag sym> class MeasuredValues {
 
     void combine_appliances_to_injection_measurements(StateEstimationInput<sym> const& input,
                                                       MathModelTopology const& topo, Idx const bus) {
+        auto const [n_unmeasured, appliance_injection_measurement, injection_measurement] =
+            combine_injection_measurements(input, topo, bus);
+
+        bus_appliance_injection_[bus] = appliance_injection_measurement;
+        bus_injection_[bus].n_unmeasured_appliances = n_unmeasured;
+
+        if (injection_measurement.has_value()) {
+            bus_injection_[bus].idx_bus_injection = static_cast<Idx>(power_main_value_.size());
+            power_main_value_.push_back(injection_measurement.value());
+        } else {
+            bus_injection_[bus].idx_bus_injection = unmeasured;
+        }
+    }
+
+    struct InjectionMeasurements {
+        Idx n_unmeasured_appliances;
+        PowerSensorCalcParam<sym> appliance_injection;
+        std::optional<PowerSensorCalcParam<sym>> injection; // empty if the bus injection is not measured
+    };
+
+    InjectionMeasurements combine_injection_measurements(StateEstimationInput<sym> const& input,
+                                                         MathModelTopology const& topo, Idx const bus) const {
         Idx n_unmeasured = 0;
         PowerSensorCalcParam<sym> appliance_injection_measurement{};
 
@@ -322,9 +363,6 @@ template <symmetry_tag sym> class MeasuredValues {
             add_appliance_measurements(idx_source_power_[source], appliance_injection_measurement, n_unmeasured);
         }
 
-        bus_appliance_injection_[bus] = appliance_injection_measurement;
-        bus_injection_[bus].n_unmeasured_appliances = n_unmeasured;
-
         // get direct bus injection measurement. It has infinite variance if there is no direct bus injection
         // measurement
         PowerSensorCalcParam<sym> const direct_injection_measurement =
@@ -335,32 +373,33 @@ template <symmetry_tag sym> class MeasuredValues {
         auto const uncertain_direct_injection =
             is_inf(direct_injection_measurement.p_variance) || is_inf(direct_injection_measurement.q_variance);
 
-        bus_injection_[bus].idx_bus_injection = static_cast<Idx>(power_main_value_.size());
+        InjectionMeasurements result{.n_unmeasured_appliances = n_unmeasured,
+                                     .appliance_injection = appliance_injection_measurement,
+                                     .injection = std::nullopt};
         if (n_unmeasured > 0) {
-            if (uncertain_direct_injection) {
-                bus_injection_[bus].idx_bus_injection = unmeasured;
-            } else {
+            if (!uncertain_direct_injection) {
                 // only direct injection
-                power_main_value_.push_back(direct_injection_measurement);
+                result.injection = direct_injection_measurement;
             }
         } else if (uncertain_direct_injection || any_zero(appliance_injection_measurement.p_variance) ||
                    any_zero(appliance_injection_measurement.q_variance)) {
             // only appliance injection if
             //    there is no direct injection measurement,
             //    or we have zero injection
-            power_main_value_.push_back(appliance_injection_measurement);
+            result.injection = appliance_injection_measurement;
         } else {
             // both valid, we combine again
-            power_main_value_.push_back(
-                combine_measurements(std::vector{direct_injection_measurement, appliance_injection_measurement}));
+            result.injection =
+                combine_measurements(std::vector{direct_injection_measurement, appliance_injection_measurement});
         }
+        return result;
     }
 
     // if all the connected load_gen/source are measured, their sum can be considered as an injection
     // measurement. zero injection (no connected appliances) is also considered as measured
     // invalid measurements (infinite sigma) are considered unmeasured
     void add_appliance_measurements(Idx const appliance_idx, PowerSensorCalcParam<sym>& measurements,
-                                    Idx& n_unmeasured) {
+                                    Idx& n_unmeasured) const {
         if (appliance_idx == unmeasured) {
             ++n_unmeasured;
             return;
@@ -414,6 +453,99 @@ template <symmetry_tag sym> class MeasuredValues {
         }
     }
 
+    bool refresh_voltage_measurements(StateEstimationInput<sym> const& input) {
+        MathModelTopology const& topo = math_topology();
+
+        RealValue<sym> angle_cum{};
+        n_voltage_angle_measurements_ = 0;
+        for (auto const& [bus, sensors] : enumerated_zip_sequence(topo.voltage_sensors_per_bus)) {
+            if (boost::empty(sensors)) {
+                continue;
+            }
+            auto const [aggregated, angle_measured] = combine_voltage_measurements(input, sensors);
+            if (is_inf(aggregated.variance) == has_voltage(bus)) {
+                return false;
+            }
+            if (!has_voltage(bus)) {
+                continue;
+            }
+            if (angle_measured != has_angle_measurement(bus)) {
+                return false;
+            }
+            voltage_main_value_[idx_voltage_[bus]] = aggregated;
+            if (angle_measured) {
+                ++n_voltage_angle_measurements_;
+                // accumulate angle, offset by intrinsic phase shift
+                angle_cum += arg(aggregated.value * std::exp(-1.0i * topo.phase_shift[bus]));
+            }
+        }
+
+        mean_angle_shift_ =
+            has_angle() ? RealValue<sym>{angle_cum / RealValue<sym>{static_cast<double>(n_voltage_angle_measurements_)}}
+                        : RealValue<sym>{arg(ComplexValue<sym>{1.0})};
+        return true;
+    }
+
+    bool refresh_appliance_measurements(StateEstimationInput<sym> const& input) {
+        MathModelTopology const& topo = math_topology();
+
+        for (auto const& [bus, shunts, load_gens, sources] :
+             enumerated_zip_sequence(topo.shunts_per_bus, topo.load_gens_per_bus, topo.sources_per_bus)) {
+            if (!refresh_bus_objects(shunts, topo.power_sensors_per_shunt, input.shunt_status,
+                                     input.measured_shunt_power, power_main_value_, idx_shunt_power_) ||
+                !refresh_bus_objects(load_gens, topo.power_sensors_per_load_gen, input.load_gen_status,
+                                     input.measured_load_gen_power, extra_value_, idx_load_gen_power_) ||
+                !refresh_bus_objects(sources, topo.power_sensors_per_source, input.source_status,
+                                     input.measured_source_power, extra_value_, idx_source_power_)) {
+                return false;
+            }
+
+            auto const [n_unmeasured, appliance_injection_measurement, injection_measurement] =
+                combine_injection_measurements(input, topo, bus);
+            if (n_unmeasured != bus_injection_[bus].n_unmeasured_appliances ||
+                injection_measurement.has_value() != has_bus_injection(bus)) {
+                return false;
+            }
+            bus_appliance_injection_[bus] = appliance_injection_measurement;
+            if (injection_measurement.has_value()) {
+                power_main_value_[bus_injection_[bus].idx_bus_injection] = injection_measurement.value();
+            }
+        }
+        return true;
+    }
+
+    void refresh_branch_measurements(StateEstimationInput<sym> const& input) {
+        MathModelTopology const& topo = math_topology();
+        for (Idx const branch : boost::counting_range(Idx{}, topo.n_branch())) {
+            if (has_branch_from(branch)) {
+                power_main_value_[idx_branch_from_power_[branch]] = combine_measurements(
+                    input.measured_branch_from_power, topo.power_sensors_per_branch_from.get_element_range(branch));
+            }
+            if (has_branch_to(branch)) {
+                power_main_value_[idx_branch_to_power_[branch]] = combine_measurements(
+                    input.measured_branch_to_power, topo.power_sensors_per_branch_to.get_element_range(branch));
+            }
+        }
+    }
+
+    // refresh the measurements of objects in batch for shunt, load_gen, source
+    // returns false if the status of an object changed
+    static bool refresh_bus_objects(IdxRange const& objects, grouped_idx_vector_type auto const& sensors_per_object,
+                                    IntSVector const& object_status,
+                                    std::vector<PowerSensorCalcParam<sym>> const& input_data,
+                                    std::vector<PowerSensorCalcParam<sym>>& result_data, IdxVector const& result_idx) {
+        for (Idx const object : objects) {
+            if (static_cast<bool>(object_status[object]) == (result_idx[object] == disconnected)) {
+                return false;
+            }
+            if (result_idx[object] >= 0) {
+                result_data[result_idx[object]] =
+                    combine_measurements(input_data, sensors_per_object.get_element_range(object));
+            }
+        }
+        return true;
+    }
+
     // combine multiple measurements of one quantity
     // using Kalman filter
     // if only_magnitude = true, combine the abs value of the individual data
@@ -606,4 +738,5 @@ template <symmetry_tag sym> class MeasuredValues {
 
 template class MeasuredValues<symmetric_t>;
 template class MeasuredValues<asymmetric_t>;
+
 } // namespace power_grid_model::math_solver
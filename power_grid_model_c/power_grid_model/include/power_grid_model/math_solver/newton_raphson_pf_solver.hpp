@@ -219,15 +219,21 @@ template <symmetry_tag sym> class NewtonRaphsonPFSolver : public IterativePFSolv
                                    SolverOutput<sym>& output) {
         using LinearSparseSolverType = SparseLUSolver<ComplexTensor<sym>, ComplexValue<sym>, ComplexValue<sym>>;
 
-        ComplexTensorVector<sym> linear_mat_data(y_bus.nnz_lu());
-        LinearSparseSolverType linear_sparse_solver{y_bus.shared_indptr_lu(), y_bus.shared_indices_lu(),
-                                                    y_bus.shared_diag_lu()};
-        typename LinearSparseSolverType::BlockPermArray linear_perm(y_bus.size());
-
-        detail::copy_y_bus<sym>(y_bus, linear_mat_data);
-        detail::prepare_linear_matrix_and_rhs(y_bus, input, *this->load_gens_per_bus_, *this->sources_per_bus_, output,
-                                              linear_mat_data);
-        linear_sparse_solver.prefactorize_and_solve(linear_mat_data, linear_perm, output.u, output.u);
+        if (!input.initial_u.empty()) {
+            // warm start, there is no need for the linear start voltage
+            assert(static_cast<Idx>(input.initial_u.size()) == this->n_bus_);
+            output.u = input.initial_u;
+        } else {
+            ComplexTensorVector<sym> linear_mat_data(y_bus.nnz_lu());
+            LinearSparseSolverType linear_sparse_solver{y_bus.shared_indptr_lu(), y_bus.shared_indices_lu(),
+                                                        y_bus.shared_diag_lu()};
+            typename LinearSparseSolverType::BlockPermArray linear_perm(y_bus.size());
+
+            detail::copy_y_bus<sym>(y_bus, linear_mat_data);
+            detail::prepare_linear_matrix_and_rhs(y_bus, input, *this->load_gens_per_bus_, *this->sources_per_bus_,
+                                                  output, linear_mat_data);
+            linear_sparse_solver.prefactorize_and_solve(linear_mat_data, linear_perm, output.u, output.u);
+        }
 
         // get magnitude and angle of start voltage
         for (Idx i = 0; i != this->n_bus_; ++i) {
@@ -138,7 +138,8 @@ template <symmetry_tag sym> class NewtonRaphsonSESolver {
           sparse_solver_{y_bus.shared_indptr_lu(), y_bus.shared_indices_lu(), y_bus.shared_diag_lu()},
           perm_(y_bus.size()) {}
 
-    SolverOutput<sym> run_state_estimation(YBus<sym> const& y_bus, StateEstimationInput<sym> const& input,
+    // the measured values are kept by the caller, so that the sensor mapping is reused across runs
+    SolverOutput<sym> run_state_estimation(YBus<sym> const& y_bus, MeasuredValues<sym> const& measured_values,
                                            double err_tol, Idx max_iter, CalculationInfo& calculation_info) {
         // prepare
         Timer main_timer;
@@ -150,11 +151,6 @@ template <symmetry_tag sym> class NewtonRaphsonSESolver {
 
         main_timer = Timer(calculation_info, 2220, "Math solver");
 
-        // preprocess measured value
-        sub_timer = Timer(calculation_info, 2221, "Pre-process measured value");
-        MeasuredValues<sym> const measured_values{y_bus.shared_topology(), input};
-        necessary_observability_check(measured_values, y_bus.shared_topology());
-
         // initialize voltage with initial angle
         sub_timer = Timer(calculation_info, 2223, "Initialize voltages");
         initialize_unknown(output.u, measured_values);
@@ -4,81 +4,388 @@
 
 #pragma once
 
+/*
+Observability of the state estimation
+
+The observability is decided by a topological analysis of the decoupled active power model,
+    in which all branches have the same susceptance.
+    The unknowns are the voltage angles of the buses, each power or voltage phasor measurement gives one equation.
+    - A branch power measurement determines the angle difference of both sides of the branch.
+      The buses connected by measured branches form flow islands, each with a single unknown angle.
+    - A voltage phasor measurement determines the angle of its bus.
+      All buses with a voltage phasor measurement share the same angle reference, so their flow islands are merged.
+    - A bus injection measurement is an equation in the angles of the islands of the bus and its neighbours.
+      If it touches exactly two islands, it determines their angle difference, so the islands are merged.
+      A measurement touching more islands is visited again when one of these islands is merged.
+    - The injection measurements which still touch more than two islands are eliminated numerically.
+      The grid is observable if they determine the angle differences of all remaining islands,
+      i.e. if their rank is one less than the number of remaining islands.
+    Besides, at least one voltage measurement is needed.
+
+If the grid is not observable, the buses are divided into observable islands,
+    i.e. groups of buses of which the voltage angles relative to each other are determined by the measurements.
+    Two remaining islands are in the same observable island if their angles are equal for all solutions of the
+    eliminated measurements. The undetermined angles are set to arbitrary distinct values to find them.
+*/
+
 #include "measured_values.hpp"
 
 #include "../common/exception.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <utility>
+#include <vector>
+
 namespace power_grid_model::math_solver {
 
+struct ObservabilityResult {
+    bool is_observable{};
+    Idx n_islands{};      // number of observable islands
+    IdxVector bus_island; // observable island of each bus
+};
+
 namespace detail {
 
+// disjoint set of the buses, each set is a group of buses with a single unknown angle
+class ObservableIslands {
+  public:
+    explicit ObservableIslands(Idx n_bus) : parent_(n_bus) { std::iota(parent_.begin(), parent_.end(), Idx{0}); }
+
+    Idx find(Idx bus) {
+        while (parent_[bus] != bus) {
+            parent_[bus] = parent_[parent_[bus]];
+            bus = parent_[bus];
+        }
+        return bus;
+    }
+
+    void merge(Idx bus_1, Idx bus_2) { parent_[find(bus_1)] = find(bus_2); }
+
+  private:
+    IdxVector parent_;
+};
+
+// sparse linear equation in the angles of the islands, sorted by island
+using IslandEquation = std::vector<std::pair<Idx, double>>;
+
+// incremental Gaussian elimination of equations in the angles of the islands
+//    each independent equation is kept normalized, with its first island as pivot
+class IslandAngleElimination {
+  public:
+    explicit IslandAngleElimination(Idx n_islands) : pivot_equations_(n_islands) {}
+
+    Idx rank() const { return rank_; }
+
+    void add(IslandEquation equation) {
+        while (!equation.empty()) {
+            auto const [pivot, coefficient] = equation.front();
+            IslandEquation const& pivot_equation = pivot_equations_[pivot];
+            if (pivot_equation.empty()) {
+                for (auto& [island, value] : equation) {
+                    value /= coefficient;
+                }
+                pivot_equations_[pivot] = std::move(equation);
+                ++rank_;
+                return;
+            }
+            equation = subtract(equation, coefficient, pivot_equation);
+        }
+    }
+
+    // angles of the islands which solve all equations, the undetermined angles are set to arbitrary distinct values
+    DoubleVector solution() const {
+        Idx const n_islands = std::ssize(pivot_equations_);
+        DoubleVector angles(n_islands);
+        std::mt19937_64 generator{};
+        std::uniform_real_distribution<double> distribution{1.0, 2.0};
+        for (Idx island = n_islands - 1; island >= 0; --island) {
+            IslandEquation const& pivot_equation = pivot_equations_[island];
+            if (pivot_equation.empty()) {
+                angles[island] = distribution(generator);
+                continue;
+            }
+            angles[island] = -std::transform_reduce(
+                pivot_equation.cbegin() + 1, pivot_equation.cend(), 0.0, std::plus{},
+                [&angles](auto const& island_value) { return island_value.second * angles[island_value.first]; });
+        }
+        return angles;
+    }
+
+  private:
+    static constexpr double zero_tolerance = 1e-10;
+
+    std::vector<IslandEquation> pivot_equations_;
+    Idx rank_{};
+
+    // equation - factor * pivot_equation, without the pivot
+    static IslandEquation subtract(IslandEquation const& equation, double factor,
+                                   IslandEquation const& pivot_equation) {
+        IslandEquation result;
+        result.reserve(equation.size() + pivot_equation.size());
+        auto it = equation.cbegin() + 1;
+        auto pivot_it = pivot_equation.cbegin() + 1;
+        auto const add_nonzero = [&result](Idx island, double value) {
+            if (std::abs(value) > zero_tolerance) {
+                result.emplace_back(island, value);
+            }
+        };
+        while (it != equation.cend() || pivot_it != pivot_equation.cend()) {
+            if (pivot_it == pivot_equation.cend() || (it != equation.cend() && it->first < pivot_it->first)) {
+                add_nonzero(it->first, it->second);
+                ++it;
+            } else if (it == equation.cend() || pivot_it->first < it->first) {
+                add_nonzero(pivot_it->first, -factor * pivot_it->second);
+                ++pivot_it;
+            } else {
+                add_nonzero(it->first, it->second - factor * pivot_it->second);
+                ++it;
+                ++pivot_it;
+            }
+        }
+        return result;
+    }
+};
+
+inline std::vector<IdxVector> connected_buses(MathModelTopology const& topo) {
+    std::vector<IdxVector> neighbours(topo.n_bus());
+    for (auto const& [node_from, node_to] : topo.branch_bus_idx) {
+        if (node_from == -1 || node_to == -1 || node_from == node_to) {
+            continue;
+        }
+        neighbours[node_from].push_back(node_to);
+        neighbours[node_to].push_back(node_from);
+    }
+    return neighbours;
+}
+
 template <symmetry_tag sym>
-Idx count_branch_sensors(const std::vector<BranchIdx>& branch_bus_idx, const Idx n_bus,
-                         const MeasuredValues<sym>& measured_values) {
-    Idx n_branch_sensor{};
-    std::vector<bool> measured_nodes(n_bus, false);
-    for (Idx branch = 0; branch != static_cast<Idx>(branch_bus_idx.size()); ++branch) {
-        auto const& [node_from, node_to] = branch_bus_idx[branch];
-        if (node_from == -1 || node_to == -1) {
+void merge_by_voltage_phasor_measurements(MeasuredValues<sym> const& measured_values, Idx n_bus,
+                                          ObservableIslands& islands) {
+    Idx reference_bus = -1;
+    for (Idx bus = 0; bus != n_bus; ++bus) {
+        if (!measured_values.has_voltage(bus) || !measured_values.has_angle_measurement(bus)) {
             continue;
         }
-        if ((measured_values.has_branch_from(branch) || measured_values.has_branch_to(branch)) &&
-            !(measured_nodes[node_from] && measured_nodes[node_to])) {
-            n_branch_sensor++;
-            measured_nodes[node_from] = true;
-            measured_nodes[node_to] = true;
+        if (reference_bus == -1) {
+            reference_bus = bus;
+        } else {
+            islands.merge(bus, reference_bus);
         }
     }
-    return n_branch_sensor;
 }
 
 template <symmetry_tag sym>
-Idx count_bus_injection_sensors(const Idx n_bus, const MeasuredValues<sym>& measured_values) {
-    Idx n_injection_sensor{};
-    for (Idx bus = 0; bus != n_bus; ++bus) {
-        if (measured_values.has_bus_injection(bus)) {
-            n_injection_sensor++;
+void merge_by_branch_measurements(MathModelTopology const& topo, MeasuredValues<sym> const& measured_values,
+                                  ObservableIslands& islands) {
+    for (Idx branch = 0; branch != topo.n_branch(); ++branch) {
+        auto const& [node_from, node_to] = topo.branch_bus_idx[branch];
+        if (node_from == -1 || node_to == -1) {
+            continue;
+        }
+        if (measured_values.has_branch_from(branch) || measured_values.has_branch_to(branch)) {
+            islands.merge(node_from, node_to);
         }
     }
-    return n_injection_sensor;
 }
 
+// merge the islands by the injection measurements touching exactly two islands
+//    return the buses of the injection measurements which still touch more than two islands
 template <symmetry_tag sym>
-std::tuple<Idx, Idx> count_voltage_sensors(const Idx n_bus, const MeasuredValues<sym>& measured_values) {
-    Idx n_voltage_magnitude{};
-    Idx n_voltage_phasor{};
-    for (Idx bus = 0; bus != n_bus; ++bus) {
-        if (measured_values.has_voltage(bus)) {
-            n_voltage_magnitude++;
-            if (measured_values.has_angle_measurement(bus)) {
-                n_voltage_phasor++;
+IdxVector merge_by_injection_measurements(MeasuredValues<sym> const& measured_values,
+                                          std::vector<IdxVector> const& neighbours, ObservableIslands& islands) {
+    Idx const n_bus = std::ssize(neighbours);
+    // injections touching more than two islands, waiting for a merge of the island with the given root bus
+    std::vector<IdxVector> waiting(n_bus);
+    std::vector<bool> is_used(n_bus, false);
+    std::vector<bool> is_queued(n_bus, false);
+    IdxVector to_visit;
+    for (Idx bus = n_bus - 1; bus >= 0; --bus) {
+        if (measured_values.has_bus_injection(bus)) {
+            to_visit.push_back(bus);
+            is_queued[bus] = true;
+        }
+    }
+
+    IdxVector touched_islands;
+    while (!to_visit.empty()) {
+        Idx const bus = to_visit.back();
+        to_visit.pop_back();
+        is_queued[bus] = false;
+        if (is_used[bus]) {
+            continue;
+        }
+        touched_islands.assign(1, islands.find(bus));
+        for (Idx const neighbour : neighbours[bus]) {
+            Idx const island = islands.find(neighbour);
+            if (std::ranges::find(touched_islands, island) == touched_islands.cend()) {
+                touched_islands.push_back(island);
+            }
+        }
+        if (touched_islands.size() > 2) {
+            // try again when some of the islands are merged by other measurements
+            for (Idx const island : touched_islands) {
+                waiting[island].push_back(bus);
+            }
+            continue;
+        }
+        is_used[bus] = true;
+        if (touched_islands.size() < 2) {
+            continue;
+        }
+        islands.merge(touched_islands[0], touched_islands[1]);
+        for (Idx const island : touched_islands) {
+            for (Idx const waiting_bus : waiting[island]) {
+                if (!is_queued[waiting_bus]) {
+                    is_queued[waiting_bus] = true;
+                    to_visit.push_back(waiting_bus);
+                }
             }
+            waiting[island].clear();
         }
     }
-    return std::make_tuple(n_voltage_magnitude, n_voltage_phasor);
+
+    IdxVector remaining;
+    for (Idx bus = 0; bus != n_bus; ++bus) {
+        if (measured_values.has_bus_injection(bus) && !is_used[bus]) {
+            remaining.push_back(bus);
+        }
+    }
+    return remaining;
+}
+
+// the injection measurement of the bus as equation in the angles of the islands
+inline IslandEquation injection_equation(Idx bus, std::vector<IdxVector> const& neighbours,
+                                         IdxVector const& bus_island) {
+    IslandEquation equation;
+    for (Idx const neighbour : neighbours[bus]) {
+        if (bus_island[neighbour] != bus_island[bus]) {
+            equation.emplace_back(bus_island[bus], 1.0);
+            equation.emplace_back(bus_island[neighbour], -1.0);
+        }
+    }
+    std::ranges::sort(equation);
+    IslandEquation merged;
+    for (auto const& [island, value] : equation) {
+        if (!merged.empty() && merged.back().first == island) {
+            merged.back().second += value;
+        } else {
+            merged.emplace_back(island, value);
+        }
+    }
+    return merged;
+}
+
+// number the groups of islands with equal angles, in order of the islands
+inline IdxVector group_equal_angles(DoubleVector const& angles, Idx& n_groups) {
+    constexpr double angle_tolerance = 1e-8;
+
+    Idx const n_islands = std::ssize(angles);
+    IdxVector order(n_islands);
+    std::iota(order.begin(), order.end(), Idx{0});
+    std::ranges::sort(order, [&angles](Idx x, Idx y) { return angles[x] < angles[y]; });
+    // the smallest island of each group of equal angles
+    IdxVector first_island(n_islands);
+    for (auto begin = order.cbegin(); begin != order.cend();) {
+        auto end = begin + 1;
+        while (end != order.cend() && angles[*end] - angles[*(end - 1)] < angle_tolerance) {
+            ++end;
+        }
+        Idx const first = *std::min_element(begin, end);
+        std::for_each(begin, end, [&first_island, first](Idx island) { first_island[island] = first; });
+        begin = end;
+    }
+    IdxVector group(n_islands, -1);
+    n_groups = 0;
+    for (Idx island = 0; island != n_islands; ++island) {
+        Idx& first_group = group[first_island[island]];
+        if (first_group == -1) {
+            first_group = n_groups++;
+        }
+        group[island] = first_group;
+    }
+    return group;
 }
 
 } // namespace detail
+
 template <symmetry_tag sym>
-inline void necessary_observability_check(MeasuredValues<sym> const& measured_values,
-                                          std::shared_ptr<MathModelTopology const> const& topo) {
+inline ObservabilityResult observability_analysis(MeasuredValues<sym> const& measured_values,
+                                                  MathModelTopology const& topo) {
+    Idx const n_bus{topo.n_bus()};
+    std::vector<IdxVector> const neighbours = detail::connected_buses(topo);
+    detail::ObservableIslands islands{n_bus};
+    detail::merge_by_voltage_phasor_measurements(measured_values, n_bus, islands);
+    detail::merge_by_branch_measurements(topo, measured_values, islands);
+    IdxVector const remaining_injections =
+        detail::merge_by_injection_measurements(measured_values, neighbours, islands);
 
-    Idx const n_bus{topo->n_bus()};
-    std::vector<BranchIdx> const& branch_bus_idx{topo->branch_bus_idx};
+    // number the remaining islands in order of their first bus
+    Idx n_remaining_islands{};
+    IdxVector bus_island(n_bus, -1);
+    IdxVector island_of_root(n_bus, -1);
+    for (Idx bus = 0; bus != n_bus; ++bus) {
+        Idx& island = island_of_root[islands.find(bus)];
+        if (island == -1) {
+            island = n_remaining_islands++;
+        }
+        bus_island[bus] = island;
+    }
 
-    auto const [n_voltage_magnitude, n_voltage_phasor] = detail::count_voltage_sensors(n_bus, measured_values);
-    if (n_voltage_magnitude + n_voltage_phasor < 1) {
-        throw NotObservableError{};
+    detail::IslandAngleElimination elimination{n_remaining_islands};
+    for (Idx const bus : remaining_injections) {
+        elimination.add(detail::injection_equation(bus, neighbours, bus_island));
     }
-    Idx const n_injection_sensor = detail::count_bus_injection_sensors(n_bus, measured_values);
-    Idx const n_branch_sensor = detail::count_branch_sensors(branch_bus_idx, n_bus, measured_values);
 
-    if (n_voltage_phasor == 0 && n_branch_sensor + n_injection_sensor < n_bus - 1) {
-        throw NotObservableError{};
+    ObservabilityResult result{.is_observable = measured_values.has_voltage_measurements(),
+                               .n_islands = 1,
+                               .bus_island = IdxVector(n_bus, 0)};
+    if (elimination.rank() == n_remaining_islands - 1) {
+        return result;
+    }
+    result.is_observable = false;
+    IdxVector const observable_island = detail::group_equal_angles(elimination.solution(), result.n_islands);
+    std::ranges::transform(bus_island, result.bus_island.begin(),
+                           [&observable_island](Idx island) { return observable_island[island]; });
+    return result;
+}
+
+// the error of an unobservable grid, with the observable islands found by the analysis
+template <symmetry_tag sym>
+NotObservableError observability_error(MeasuredValues<sym> const& measured_values, MathModelTopology const& topo) {
+    auto result = observability_analysis(measured_values, topo);
+    return NotObservableError{result.n_islands, std::move(result.bus_island)};
+}
+
+template <symmetry_tag sym>
+inline void observability_check(MeasuredValues<sym> const& measured_values,
+                                std::shared_ptr<MathModelTopology const> const& topo) {
+    if (auto result = observability_analysis(measured_values, *topo); !result.is_observable) {
+        throw NotObservableError{result.n_islands, std::move(result.bus_island)};
+    }
+}
+
+// get the measured values of the input, and throw if they are not observable
+//    the sensor mapping and the observability analysis are reused as long as the sensor configuration does not change
+template <symmetry_tag sym>
+MeasuredValues<sym> const& refresh_observable_measured_values(std::optional<MeasuredValues<sym>>& cached,
+                                                              bool& is_observable,
+                                                              std::shared_ptr<MathModelTopology const> const& topo,
+                                                              StateEstimationInput<sym> const& input) {
+    if (!cached.has_value() || !cached->refresh(input)) {
+        cached.emplace(topo, input);
+        is_observable = false;
+        observability_check(cached.value(), topo);
+        is_observable = true;
     }
-    if (n_voltage_phasor > 0 && n_branch_sensor + n_injection_sensor + n_voltage_phasor < n_bus) {
-        throw NotObservableError{};
+    if (!is_observable) {
+        throw observability_error(cached.value(), *topo);
     }
+    return cached.value();
 }
 
 } // namespace power_grid_model::math_solver
@@ -0,0 +1,128 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+/*
+Sequence decoupled solver for balanced three-phase block matrices
+
+A three-phase block is balanced if it is diagonal in the sequence domain
+    Y_012 = T^-1 * Y_abc * T
+where T is the symmetric component matrix.
+This is the case for all branches and shunts built from sequence parameters, including the phase shift of transformers.
+
+If all blocks of the matrix are balanced, the zero, positive and negative sequence networks are decoupled.
+The block system A * x = b is then solved as three scalar systems
+    A_k * x_k = b_k,    k = 0, 1, 2
+    b_012 = T^-1 * b,   x = T * x_012
+Three scalar factorizations take far fewer operations than one factorization with 3x3 blocks.
+*/
+
+#include "sparse_lu_solver.hpp"
+#include "y_bus.hpp"
+
+#include "../common/common.hpp"
+#include "../common/exception.hpp"
+#include "../common/three_phase_tensor.hpp"
+
+#include <array>
+#include <optional>
+
+namespace power_grid_model::math_solver {
+
+// sequence components of a balanced block, empty if the block couples the sequences
+inline std::optional<ComplexValue<asymmetric_t>>
+balanced_sequence_components(ComplexTensor<asymmetric_t> const& block) {
+    // relative tolerance of the coupling between the sequences
+    constexpr double balance_tolerance = 1e-12;
+    static ComplexTensor<asymmetric_t> const sym_matrix = get_sym_matrix();
+    static ComplexTensor<asymmetric_t> const sym_matrix_inv = get_sym_matrix_inv();
+
+    ComplexTensor<asymmetric_t> const sequence_block = dot(sym_matrix_inv, block, sym_matrix);
+    double const threshold = balance_tolerance * cabs(block).maxCoeff();
+    for (Idx row = 0; row != 3; ++row) {
+        for (Idx col = 0; col != 3; ++col) {
+            if (row != col && cabs(sequence_block(row, col)) > threshold) {
+                return std::nullopt;
+            }
+        }
+    }
+    // remove the rounding noise of the transformation, e.g. the zero sequence of a delta winding
+    ComplexValue<asymmetric_t> components{sequence_block(0, 0), sequence_block(1, 1), sequence_block(2, 2)};
+    for (Idx sequence = 0; sequence != 3; ++sequence) {
+        if (cabs(components(sequence)) <= threshold) {
+            components(sequence) = 0.0;
+        }
+    }
+    return components;
+}
+
+class SequenceDecoupledSolver {
+  public:
+    using ScalarSolverType = SparseLUSolver<DoubleComplex, DoubleComplex, DoubleComplex>;
+
+    // split the block matrix, with the LU structure of the Y bus, in the sequence matrices and factorize them
+    //    return empty if any of the blocks is not balanced, or if any of the sequence matrices is singular
+    static std::optional<SequenceDecoupledSolver> factorize(YBus<asymmetric_t> const& y_bus,
+                                                            ComplexTensorVector<asymmetric_t> const& data) {
+        SequenceDecoupledSolver solver{y_bus};
+        for (auto& sequence_data : solver.sequence_data_) {
+            sequence_data.resize(data.size());
+        }
+        for (Idx entry = 0; entry != static_cast<Idx>(data.size()); ++entry) {
+            auto const components = balanced_sequence_components(data[entry]);
+            if (!components.has_value()) {
+                return std::nullopt;
+            }
+            for (Idx sequence = 0; sequence != 3; ++sequence) {
+                solver.sequence_data_[sequence][entry] = components.value()(sequence);
+            }
+        }
+        try {
+            for (auto& sequence_data : solver.sequence_data_) {
+                solver.sparse_solver_.prefactorize(sequence_data, solver.perm_);
+            }
+        } catch (SparseMatrixError const&) {
+            return std::nullopt;
+        }
+        return solver;
+    }
+
+    // solve the block system with the factorized sequence matrices, x and rhs may be the same vector
+    void solve(ComplexValueVector<asymmetric_t> const& rhs, ComplexValueVector<asymmetric_t>& x) const {
+        static ComplexTensor<asymmetric_t> const sym_matrix = get_sym_matrix();
+        static ComplexTensor<asymmetric_t> const sym_matrix_inv = get_sym_matrix_inv();
+        Idx const size = static_cast<Idx>(rhs.size());
+
+        std::array<ComplexValueVector<symmetric_t>, 3> sequence_x;
+        for (auto& sequence : sequence_x) {
+            sequence.resize(size);
+        }
+        for (Idx bus = 0; bus != size; ++bus) {
+            ComplexValue<asymmetric_t> const sequence_rhs = dot(sym_matrix_inv, rhs[bus]);
+            for (Idx sequence = 0; sequence != 3; ++sequence) {
+                sequence_x[sequence][bus] = sequence_rhs(sequence);
+            }
+        }
+        for (Idx sequence = 0; sequence != 3; ++sequence) {
+            sparse_solver_.solve_with_prefactorized_matrix(sequence_data_[sequence], perm_, sequence_x[sequence],
+                                                           sequence_x[sequence]);
+        }
+        for (Idx bus = 0; bus != size; ++bus) {
+            ComplexValue<asymmetric_t> const sequence_value{sequence_x[0][bus], sequence_x[1][bus],
+                                                            sequence_x[2][bus]};
+            x[bus] = dot(sym_matrix, sequence_value);
+        }
+    }
+
+  private:
+    ScalarSolverType sparse_solver_;
+    ScalarSolverType::BlockPermArray perm_{};
+    std::array<ComplexValueVector<symmetric_t>, 3> sequence_data_;
+
+    explicit SequenceDecoupledSolver(YBus<asymmetric_t> const& y_bus)
+        : sparse_solver_{y_bus.shared_indptr_lu(), y_bus.shared_indices_lu(), y_bus.shared_diag_lu()} {}
+};
+
+} // namespace power_grid_model::math_solver
@@ -60,6 +60,62 @@ template <symmetry_tag sym> class ShortCircuitSolver {
         return output;
     }
 
+    // fault sweep: each fault is calculated independently, as if it were the only fault in the network
+    //    the pre-fault network is factorized once,
+    //    the fault current then follows in closed form from the Thevenin equivalent at the fault bus
+    //        u_bus = u_pre_fault - Z_bus * i_fault
+    //    where Z_bus is the diagonal block of the inverse of the pre-fault matrix
+    // only the fault output is calculated
+    ShortCircuitSolverOutput<sym> run_fault_sweep(YBus<sym> const& y_bus, ShortCircuitInput const& input) {
+        for (FaultCalcParam const& fault : input.faults) {
+            check_fault_valid(fault);
+        }
+
+        // output
+        ShortCircuitSolverOutput<sym> output;
+        output.fault.resize(input.faults.size());
+
+        // pre-fault voltage, with the sources only
+        ComplexValueVector<sym> u_pre_fault(n_bus_);
+        detail::copy_y_bus<sym>(y_bus, mat_data_);
+        IdxVector const& bus_entry = y_bus.lu_diag();
+        for (auto const& [bus_number, sources] : enumerated_zip_sequence(*sources_per_bus_)) {
+            detail::add_sources<sym>(sources, bus_number, y_bus, input.source, mat_data_[bus_entry[bus_number]],
+                                     u_pre_fault[bus_number]);
+        }
+        sparse_solver_.prefactorize_and_solve(mat_data_, perm_, u_pre_fault, u_pre_fault);
+
+        // Thevenin impedance of the faulted buses, by solving unit injections with the same factorization
+        ComplexValueVector<sym> unit_rhs(n_bus_);
+        ComplexValueVector<sym> z_column(n_bus_);
+        for (auto const& [bus_number, faults] : enumerated_zip_sequence(input.fault_buses)) {
+            if (faults.empty()) {
+                continue;
+            }
+            ComplexTensor<sym> z_bus{};
+            if constexpr (is_symmetric_v<sym>) {
+                unit_rhs[bus_number] = 1.0;
+                sparse_solver_.solve_with_prefactorized_matrix(mat_data_, perm_, unit_rhs, z_column);
+                z_bus = z_column[bus_number];
+            } else {
+                for (Idx phase = 0; phase != 3; ++phase) {
+                    unit_rhs[bus_number](phase) = 1.0;
+                    sparse_solver_.solve_with_prefactorized_matrix(mat_data_, perm_, unit_rhs, z_column);
+                    z_bus.col(phase) = z_column[bus_number];
+                    unit_rhs[bus_number](phase) = 0.0;
+                }
+            }
+            unit_rhs[bus_number] = ComplexValue<sym>{};
+
+            for (Idx const fault_number : faults) {
+                output.fault[fault_number].i_fault =
+                    thevenin_fault_current(input.faults[fault_number], z_bus, u_pre_fault[bus_number]);
+            }
+        }
+
+        return output;
+    }
+
   private:
     Idx n_bus_;
     Idx n_fault_;
@@ -358,6 +414,83 @@ template <symmetry_tag sym> class ShortCircuitSolver {
         output.shunt = y_bus.template calculate_shunt_flow<ApplianceShortCircuitSolverOutput<sym>>(output.u_bus);
     }
 
+    // fault current of a single fault at a bus with Thevenin impedance z_bus and pre-fault voltage u_pre_fault
+    //    the fault is described by linear relations between the bus voltage and the fault current
+    //        M_i * i_fault + M_u * u_bus = 0,    u_bus = u_pre_fault - z_bus * i_fault
+    //    so that
+    //        (M_i - M_u * z_bus) * i_fault = -M_u * u_pre_fault
+    static ComplexValue<sym> thevenin_fault_current(FaultCalcParam const& fault, ComplexTensor<sym> const& z_bus,
+                                                    ComplexValue<sym> const& u_pre_fault) {
+        using enum FaultType;
+
+        DoubleComplex const y_fault = fault.y_fault;
+        bool const is_bolted = std::isinf(y_fault.real());
+
+        if constexpr (is_symmetric_v<sym>) {
+            assert(fault.fault_type == three_phase);
+            return is_bolted ? u_pre_fault / z_bus : y_fault * u_pre_fault / (1.0 + y_fault * z_bus);
+        } else {
+            auto const [phase_1, phase_2] = set_phase_index(fault.fault_phase);
+            ComplexTensor<sym> m_i{};
+            ComplexTensor<sym> m_u{};
+            // phases which are not part of the fault have no fault current
+            for (Idx phase = 0; phase != 3; ++phase) {
+                m_i(phase, phase) = 1.0;
+            }
+            // fault from a phase to ground
+            //    bolted: u_p = 0,              otherwise: i_p = y_fault * u_p
+            auto const set_phase_to_ground = [&m_i, &m_u, is_bolted, y_fault](Idx phase) {
+                m_i(phase, phase) = is_bolted ? 0.0 : 1.0;
+                m_u(phase, phase) = is_bolted ? DoubleComplex{1.0} : -y_fault;
+            };
+
+            switch (fault.fault_type) {
+            case three_phase:
+                for (Idx phase = 0; phase != 3; ++phase) {
+                    set_phase_to_ground(phase);
+                }
+                break;
+            case single_phase_to_ground:
+                set_phase_to_ground(phase_1);
+                break;
+            case two_phase:
+                // i_1 + i_2 = 0
+                m_i(phase_2, phase_1) = 1.0;
+                // bolted: u_1 - u_2 = 0,       otherwise: i_1 = y_fault * (u_1 - u_2)
+                set_phase_to_ground(phase_1);
+                m_u(phase_1, phase_2) = -m_u(phase_1, phase_1);
+                break;
+            case two_phase_to_ground:
+                // u_1 - u_2 = 0
+                m_i(phase_1, phase_1) = 0.0;
+                m_u(phase_1, phase_1) = 1.0;
+                m_u(phase_1, phase_2) = -1.0;
+                // bolted: u_1 = 0,             otherwise: i_1 + i_2 = y_fault * u_1
+                if (is_bolted) {
+                    m_i(phase_2, phase_2) = 0.0;
+                    m_u(phase_2, phase_1) = 1.0;
+                } else {
+                    m_i(phase_2, phase_1) = 1.0;
+                    m_u(phase_2, phase_1) = -y_fault;
+                }
+                break;
+            default:
+                throw InvalidShortCircuitPhaseOrType{};
+            }
+
+            ComplexTensor<sym> const lhs = m_i - dot(m_u, z_bus);
+            ComplexValue<sym> const rhs = -dot(m_u, u_pre_fault);
+            return ComplexValue<sym>{lhs.matrix().partialPivLu().solve(rhs.matrix()).array()};
+        }
+    }
+
+    static void check_fault_valid(FaultCalcParam const& fault) {
+        if (fault.fault_type == FaultType::nan || fault.fault_phase == FaultPhase::default_value ||
+            fault.fault_phase == FaultPhase::nan) {
+            throw InvalidShortCircuitPhaseOrType{};
+        }
+    }
+
     static constexpr auto set_phase_index(FaultPhase fault_phase) {
         IntS phase_1{-1};
         IntS phase_2{-1};
@@ -9,7 +9,10 @@
 #include "../common/three_phase_tensor.hpp"
 #include "../common/typing.hpp"
 
+#include <algorithm>
+#include <array>
 #include <memory>
+#include <vector>
 
 namespace power_grid_model::math_solver {
 
@@ -43,7 +46,6 @@ struct sparse_lu_entry_trait<Tensor, RHSVector, XVector> {
     static constexpr Idx block_size = 1;
     using Scalar = Tensor;
     using Matrix = Tensor;
-    using LUFactor = void;
     struct BlockPerm {};
     using BlockPermArray = Idx;
 };
@@ -55,23 +57,85 @@ struct sparse_lu_entry_trait<Tensor, RHSVector, XVector> {
     static constexpr Idx block_size = Tensor::RowsAtCompileTime;
     using Scalar = typename Tensor::Scalar;
     using Matrix = Eigen::Matrix<Scalar, block_size, block_size, Tensor::Options>;
-    using LUFactor = Eigen::FullPivLU<Eigen::Ref<Matrix>>; // LU decomposition with full pivoting in place
+    // row interchanges of the partial pivoting, row k is swapped with row row_swap[k], in increasing order of k
     struct BlockPerm {
-        typename LUFactor::PermutationPType p;
-        typename LUFactor::PermutationQType q;
-    }; // Extract permutation matrices p and q from LUFactor
+        std::array<Idx, block_size> row_swap;
+    };
     using BlockPermArray = std::vector<BlockPerm>;
 };
 
+// dense LU factorization of a fixed size block in-place, with partial pivoting
+//    P * A = L * U, the diagonal of L is one and not stored
+// the block size is known at compile time, so the loops are unrolled per block type
+//    this is much cheaper than a generic dense factorization with full pivoting
+// return false if the block is singular
+template <class Tensor, class BlockPerm> bool factorize_block_in_place(Tensor& block, BlockPerm& block_perm) {
+    using Scalar = typename Tensor::Scalar;
+    constexpr Idx block_size = Tensor::RowsAtCompileTime;
+    // set a low threshold, because state estimation can have large differences in eigen values
+    constexpr double threshold = 1e-100;
+
+    double max_pivot{};
+    for (Idx pivot = 0; pivot != block_size; ++pivot) {
+        // choose the largest entry in the column as pivot
+        Idx pivot_row = pivot;
+        double pivot_abs2 = Eigen::numext::abs2(block(pivot, pivot));
+        for (Idx row = pivot + 1; row != block_size; ++row) {
+            double const entry_abs2 = Eigen::numext::abs2(block(row, pivot));
+            if (entry_abs2 > pivot_abs2) {
+                pivot_row = row;
+                pivot_abs2 = entry_abs2;
+            }
+        }
+        block_perm.row_swap[pivot] = pivot_row;
+        if (pivot_row != pivot) {
+            block.row(pivot).swap(block.row(pivot_row));
+        }
+        max_pivot = std::max(max_pivot, pivot_abs2);
+        if (!(pivot_abs2 > 0.0)) {
+            return false;
+        }
+
+        // eliminate the entries below the pivot
+        Scalar const inverse_pivot = Scalar{1.0} / block(pivot, pivot);
+        for (Idx row = pivot + 1; row != block_size; ++row) {
+            block(row, pivot) *= inverse_pivot;
+            for (Idx col = pivot + 1; col != block_size; ++col) {
+                block(row, col) -= block(row, pivot) * block(pivot, col);
+            }
+        }
+    }
+
+    // same rank criterion as a rank revealing factorization
+    for (Idx pivot = 0; pivot != block_size; ++pivot) {
+        if (!(Eigen::numext::abs2(block(pivot, pivot)) > threshold * threshold * max_pivot)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// apply the row interchanges of the block factorization to the rows of a block or a vector
+template <class BlockPerm, class Block> void permute_block_rows(BlockPerm const& block_perm, Block& block) {
+    for (Idx row = 0; row != static_cast<Idx>(block_perm.row_swap.size()); ++row) {
+        if (Idx const swap_row = block_perm.row_swap[row]; swap_row != row) {
+            block.row(row).swap(block.row(swap_row));
+        }
+    }
+}
+
 template <class Tensor, class RHSVector, class XVector> class SparseLUSolver {
   public:
     using entry_trait = sparse_lu_entry_trait<Tensor, RHSVector, XVector>;
     static constexpr bool is_block = entry_trait::is_block;
     static constexpr Idx block_size = entry_trait::block_size;
     using Scalar = typename entry_trait::Scalar;
-    using LUFactor = typename entry_trait::LUFactor;
     using BlockPerm = typename entry_trait::BlockPerm;
     using BlockPermArray = typename entry_trait::BlockPermArray;
+    using DenseMatrix = Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>;
+    // complex blocks are multiplied in split complex form in the factorization, see SplitComplex
+    static constexpr bool use_split_complex = is_block && std::same_as<Scalar, DoubleComplex>;
+    using SplitBlock = SplitComplex<Eigen::Matrix<double, block_size, block_size>>;
 
     SparseLUSolver(std::shared_ptr<IdxVector const> const& row_indptr, // indptr including fill-ins
                    std::shared_ptr<IdxVector const> col_indices,       // indices including fill-ins
@@ -96,7 +160,7 @@ template <class Tensor, class RHSVector, class XVector> class SparseLUSolver {
     void
     solve_with_prefactorized_matrix(std::vector<Tensor> const& data,        // pre-factoirzed data, const ref
                                     BlockPermArray const& block_perm_array, // pre-calculated permutation, const ref
-                                    std::vector<RHSVector> const& rhs, std::vector<XVector>& x) {
+                                    std::vector<RHSVector> const& rhs, std::vector<XVector>& x) const {
         // local reference
         auto const& row_indptr = *row_indptr_;
         auto const& col_indices = *col_indices_;
@@ -106,10 +170,9 @@ template <class Tensor, class RHSVector, class XVector> class SparseLUSolver {
         // forward substitution with L
         for (Idx row = 0; row != size_; ++row) {
             // permutation if needed
+            x[row] = rhs[row];
             if constexpr (is_block) {
-                x[row] = (block_perm_array[row].p * rhs[row].matrix()).array();
-            } else {
-                x[row] = rhs[row];
+                permute_block_rows(block_perm_array[row], x[row]);
             }
 
             // loop all columns until diagonal
@@ -157,10 +220,57 @@ template <class Tensor, class RHSVector, class XVector> class SparseLUSolver {
                 x[row] = x[row] / lu_matrix[diag_lu[row]];
             }
         }
-        // restore permutation for block matrix
-        if constexpr (is_block) {
-            for (Idx row = 0; row != size_; ++row) {
-                x[row] = (block_perm_array[row].q * x[row].matrix()).array();
+    }
+
+    // solve the low-rank modified matrix (A + P * D * P^T) x = rhs with the existing pre-factorization of A
+    //    by compensation (Sherman-Morrison-Woodbury identity), without refactorizing
+    // P selects the (block) rows/columns of the ports, D is the dense change of the matrix between the ports,
+    //    with block_size * ports.size() rows and columns
+    //    x = x0 - Z * (I + D * P^T * Z)^-1 * D * P^T * x0,    x0 = A^-1 * rhs,    Z = A^-1 * P
+    // this needs block_size * ports.size() extra solves, so it only pays off if the number of ports is small
+    // throws SparseMatrixError if the modified matrix is singular
+    void solve_with_low_rank_update(std::vector<Tensor> const& data, BlockPermArray const& block_perm_array,
+                                    IdxVector const& ports, DenseMatrix const& delta,
+                                    std::vector<RHSVector> const& rhs, std::vector<XVector>& x) {
+        Idx const rank = block_size * static_cast<Idx>(ports.size());
+        assert(delta.rows() == rank && delta.cols() == rank);
+
+        solve_with_prefactorized_matrix(data, block_perm_array, rhs, x);
+        if (rank == 0) {
+            return;
+        }
+
+        // Z = A^-1 * P, column by column
+        std::vector<std::vector<XVector>> z(rank, std::vector<XVector>(size_));
+        std::vector<RHSVector> unit_rhs(size_, zero_vector<RHSVector>());
+        for (Idx col = 0; col != rank; ++col) {
+            Scalar& unit = block_entry(unit_rhs[ports[col / block_size]], col % block_size);
+            unit = Scalar{1.0};
+            solve_with_prefactorized_matrix(data, block_perm_array, unit_rhs, z[col]);
+            unit = Scalar{0.0};
+        }
+
+        // M = I + D * P^T * Z
+        DenseMatrix pz(rank, rank);
+        Eigen::Matrix<Scalar, Eigen::Dynamic, 1> px(rank);
+        for (Idx row = 0; row != rank; ++row) {
+            Idx const bus = ports[row / block_size];
+            for (Idx col = 0; col != rank; ++col) {
+                pz(row, col) = block_entry(z[col][bus], row % block_size);
+            }
+            px(row) = block_entry(x[bus], row % block_size);
+        }
+        DenseMatrix const m = DenseMatrix::Identity(rank, rank) + delta * pz;
+        Eigen::FullPivLU<DenseMatrix> const m_lu{m};
+        if (!m_lu.isInvertible()) {
+            throw SparseMatrixError{};
+        }
+        Eigen::Matrix<Scalar, Eigen::Dynamic, 1> const y = m_lu.solve(delta * px);
+
+        // x = x0 - Z * y
+        for (Idx row = 0; row != size_; ++row) {
+            for (Idx col = 0; col != rank; ++col) {
+                x[row] -= z[col][row] * y(col);
             }
         }
     }
@@ -181,24 +291,21 @@ template <class Tensor, class RHSVector, class XVector> class SparseLUSolver {
 
         // column position idx per row for LU matrix
         IdxVector col_position_idx(row_indptr.cbegin(), row_indptr.cend() - 1);
+        // U blocks in the right of the pivot in split complex form, they are multiplied with all L blocks below
+        std::vector<SplitBlock> split_u;
 
         // start pivoting, it is always the diagonal
         for (Idx pivot_row_col = 0; pivot_row_col != size_; ++pivot_row_col) {
             Idx const pivot_idx = diag_lu[pivot_row_col];
 
             // Dense LU factorize pivot for block matrix in-place
-            // A_pivot,pivot, becomes P_pivot^-1 * L_pivot * U_pivot * Q_pivot^-1
+            // A_pivot,pivot, becomes P_pivot^-1 * L_pivot * U_pivot
             // return reference to pivot permutation
             BlockPerm const& block_perm = [&]() -> std::conditional_t<is_block, BlockPerm const&, BlockPerm> {
                 if constexpr (is_block) {
-                    LUFactor lu_factor(lu_matrix[pivot_idx]);
-                    // set a low threshold, because state estimation can have large differences in eigen values
-                    lu_factor.setThreshold(1e-100);
-                    if (lu_factor.rank() < block_size) {
+                    if (!factorize_block_in_place(lu_matrix[pivot_idx], block_perm_array[pivot_row_col])) {
                         throw SparseMatrixError{};
                     }
-                    // record block permutation
-                    block_perm_array[pivot_row_col] = {lu_factor.permutationP(), lu_factor.permutationQ()};
                     return block_perm_array[pivot_row_col];
                 } else {
                     if (!is_normal(lu_matrix[pivot_idx])) {
@@ -213,21 +320,16 @@ template <class Tensor, class RHSVector, class XVector> class SparseLUSolver {
             // for block matrix
             // permute rows of L's in the left of the pivot
             // L_k,pivot = P_pivot * L_k,pivot    k < pivot
-            // permute columns of U's above the pivot
-            // U_pivot,k = U_pivot,k * Q_pivot    k < pivot
             if constexpr (is_block) {
                 // loop rows and columns at the same time
                 // since the matrix is symmetric
                 for (Idx l_idx = row_indptr[pivot_row_col]; l_idx < pivot_idx; ++l_idx) {
                     // permute rows of L_k,pivot
-                    lu_matrix[l_idx] = (block_perm.p * lu_matrix[l_idx].matrix()).array();
-                    // get row and idx of u
+                    permute_block_rows(block_perm, lu_matrix[l_idx]);
+                    // get row of u, and skip the U_pivot,k above the pivot
                     Idx const u_row = col_indices[l_idx];
-                    Idx const u_idx = col_position_idx[u_row];
                     // we should exactly find the current column
-                    assert(col_indices[u_idx] == pivot_row_col);
-                    // permute columns of U_pivot,k
-                    lu_matrix[u_idx] = (lu_matrix[u_idx].matrix() * block_perm.q).array();
+                    assert(col_indices[col_position_idx[u_row]] == pivot_row_col);
                     // increment column position
                     ++col_position_idx[u_row];
                 }
@@ -240,7 +342,7 @@ template <class Tensor, class RHSVector, class XVector> class SparseLUSolver {
                 for (Idx u_idx = pivot_idx + 1; u_idx < row_indptr[pivot_row_col + 1]; ++u_idx) {
                     Tensor& u = lu_matrix[u_idx];
                     // permutation
-                    u = (block_perm.p * u.matrix()).array();
+                    permute_block_rows(block_perm, u);
                     // forward substitution, per row in u
                     for (Idx block_row = 0; block_row < block_size; ++block_row) {
                         for (Idx block_col = 0; block_col < block_row; ++block_col) {
@@ -251,6 +353,13 @@ template <class Tensor, class RHSVector, class XVector> class SparseLUSolver {
                 }
             }
 
+            if constexpr (use_split_complex) {
+                split_u.clear();
+                for (Idx u_idx = pivot_idx + 1; u_idx < row_indptr[pivot_row_col + 1]; ++u_idx) {
+                    split_u.push_back(split_complex(lu_matrix[u_idx]));
+                }
+            }
+
             // start to calculate L below the pivot and U at the right of the pivot column
             // because the matrix is symmetric,
             //    looking for col_indices at pivot_row_col, starting from the diagonal (pivot_row_col, pivot_row_col)
@@ -265,10 +374,8 @@ template <class Tensor, class RHSVector, class XVector> class SparseLUSolver {
                 if constexpr (is_block) {
                     // for block matrix
                     // calculate L blocks below the pivot, in-place
-                    // L_k,pivot * U_pivot = A_k_pivot * Q_pivot    k > pivot
+                    // L_k,pivot * U_pivot = A_k_pivot    k > pivot
                     Tensor& l = lu_matrix[l_idx];
-                    // permutation
-                    l = (l.matrix() * block_perm.q).array();
                     // forward substitution, per column in l
                     // l0 = [l00, l10]^T
                     // l1 = [l01, l11]^T
@@ -292,6 +399,13 @@ template <class Tensor, class RHSVector, class XVector> class SparseLUSolver {
                     lu_matrix[l_idx] = lu_matrix[l_idx] / pivot;
                 }
                 Tensor const& l = lu_matrix[l_idx];
+                [[maybe_unused]] auto const split_l = [&l] {
+                    if constexpr (use_split_complex) {
+                        return split_complex(l);
+                    } else {
+                        return SplitBlock{};
+                    }
+                }();
 
                 // for all entries in the right of (l_row, u_col)
                 //       A(l_row, u_col) = A(l_row, u_col) - l * U(pivot_row_col, u_col),
@@ -312,7 +426,11 @@ template <class Tensor, class RHSVector, class XVector> class SparseLUSolver {
                     assert(*found == u_col);
                     a_idx = narrow_cast<Idx>(std::distance(col_indices.cbegin(), found));
                     // subtract
-                    lu_matrix[a_idx] -= dot(l, lu_matrix[u_idx]);
+                    if constexpr (use_split_complex) {
+                        subtract_dot(lu_matrix[a_idx], split_l, split_u[u_idx - pivot_idx - 1]);
+                    } else {
+                        lu_matrix[a_idx] -= dot(l, lu_matrix[u_idx]);
+                    }
                 }
                 // iterate column position
                 ++col_position_idx[l_row];
@@ -323,6 +441,25 @@ template <class Tensor, class RHSVector, class XVector> class SparseLUSolver {
     }
 
   private:
+    template <class Vector> static Vector zero_vector() {
+        if constexpr (is_block) {
+            Vector zero;
+            zero.setZero();
+            return zero;
+        } else {
+            return Vector{0.0};
+        }
+    }
+
+    template <class Vector> static auto& block_entry(Vector& vector, Idx block_idx) {
+        if constexpr (is_block) {
+            return vector(block_idx);
+        } else {
+            assert(block_idx == 0);
+            return vector;
+        }
+    }
+
     Idx size_;
     Idx nnz_; // number of non zeroes (in block)
     std::shared_ptr<IdxVector const> row_indptr_;
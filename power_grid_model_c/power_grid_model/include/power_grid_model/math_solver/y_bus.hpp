@@ -306,6 +306,7 @@ template <symmetry_tag sym> class YBus {
     IdxVector const& y_bus_entry_indptr() const { return y_bus_struct_->y_bus_entry_indptr; }
     MathModelTopology const& math_topology() const { return *math_topology_; }
     MathModelParam<sym> const& math_model_param() const { return *math_model_param_; }
+    std::shared_ptr<MathModelParam<sym> const> const& shared_math_model_param() const { return math_model_param_; }
 
     ComplexTensorVector<sym> const& admittance() const { return admittance_; }
     IdxVector const& bus_entry() const { return y_bus_struct_->bus_entry; }
@@ -512,6 +513,9 @@ template <symmetry_tag sym> class YBus {
         parameters_changed_callbacks_.erase(key);
     }
 
+    /// @brief unregister all callbacks, e.g. when the objects they refer to are moved
+    void clear_parameters_changed_callbacks() { parameters_changed_callbacks_.clear(); }
+
   private:
     // csr structure
     std::shared_ptr<YBusStructure const> y_bus_struct_;
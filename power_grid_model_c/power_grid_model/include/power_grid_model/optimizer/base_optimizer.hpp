@@ -7,9 +7,23 @@
 #include "../main_core/state.hpp"
 
 #include <concepts>
+#include <vector>
 
 namespace power_grid_model::optimizer {
 
+// updates of components of one type, together with the position of the components in the container
+//    this lets the state updater skip the ID lookup of an update dataset
+template <typename Component> struct ComponentUpdate {
+    using ComponentType = Component;
+
+    std::vector<typename Component::UpdateType> updates;
+    std::vector<Idx2D> sequence_idx;
+};
+
+// state updater that can update the components in place, without a round-trip through an update dataset
+template <typename StateUpdater, typename Component>
+concept direct_state_updater_c = std::invocable<std::remove_cvref_t<StateUpdater>, ComponentUpdate<Component> const&>;
+
 namespace detail {
 template <typename StateCalculator, typename State>
 concept state_calculator_c =
@@ -33,6 +47,13 @@ concept steady_state_calculator_c =
     std::same_as<detail::state_calculator_result_t<StateCalculator, State>,
                  std::vector<typename detail::state_calculator_result_t<StateCalculator, State>::value_type>>;
 
+// steady state calculator that can start from the result of a previous calculation
+template <typename StateCalculator, typename State>
+concept warm_start_calculator_c =
+    steady_state_calculator_c<StateCalculator, State> &&
+    std::invocable<std::remove_cvref_t<StateCalculator>, std::remove_cvref_t<State> const&, CalculationMethod,
+                   state_calculator_result_t<StateCalculator, State> const&>;
+
 template <typename StateCalculator, typename State_>
     requires state_calculator_c<StateCalculator, State_>
 class BaseOptimizer {
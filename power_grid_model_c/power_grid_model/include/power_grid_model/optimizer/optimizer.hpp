@@ -18,7 +18,9 @@ template <typename State, typename UpdateType, typename StateCalculator, typenam
     requires detail::state_calculator_c<StateCalculator, State> &&
              std::invocable<std::remove_cvref_t<StateUpdater>, UpdateType>
 constexpr auto get_optimizer(OptimizerType optimizer_type, OptimizerStrategy strategy, StateCalculator calculator,
-                             StateUpdater updater, meta_data::MetaData const& meta_data) {
+                             StateUpdater updater, meta_data::MetaData const& meta_data,
+                             tap_position_optimizer::RegulatorOrderCache* regulator_order_cache = nullptr,
+                             bool warm_start = false) {
     using enum OptimizerType;
     using namespace std::string_literals;
     using BaseOptimizer = detail::BaseOptimizer<StateCalculator, State>;
@@ -31,7 +33,7 @@ constexpr auto get_optimizer(OptimizerType optimizer_type, OptimizerStrategy str
                       std::invocable<std::remove_cvref_t<StateUpdater>, ConstDataset const&> &&
                       main_core::component_container_c<typename State::ComponentContainer, TransformerTapRegulator>) {
             return BaseOptimizer::template make_shared<TapPositionOptimizer<StateCalculator, StateUpdater, State>>(
-                std::move(calculator), std::move(updater), strategy, meta_data);
+                std::move(calculator), std::move(updater), strategy, meta_data, regulator_order_cache, warm_start);
         }
         [[fallthrough]];
     default:
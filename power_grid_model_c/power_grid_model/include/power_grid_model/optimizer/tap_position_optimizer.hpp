@@ -19,8 +19,11 @@
 
 #include <boost/graph/compressed_sparse_row_graph.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <functional>
 #include <queue>
+#include <unordered_map>
 #include <ranges>
 #include <variant>
 #include <vector>
@@ -384,17 +387,29 @@ template <transformer_c... TransformerTypes> struct TapRegulatorRef {
     TransformerWrapper<TransformerTypes...> transformer;
 };
 
+// sequence number of the regulator of each regulated object
+using RegulatorIndex = std::unordered_map<ID, Idx>;
+
 template <typename State>
     requires main_core::component_container_c<typename State::ComponentContainer, TransformerTapRegulator>
-TransformerTapRegulator const& find_regulator(State const& state, ID regulated_object) {
-    auto const regulators = get_component_citer<TransformerTapRegulator>(state);
+RegulatorIndex build_regulator_index(State const& state) {
+    RegulatorIndex result;
+    result.reserve(main_core::get_component_size<TransformerTapRegulator>(state));
+    Idx sequence = 0;
+    for (auto const& regulator : get_component_citer<TransformerTapRegulator>(state)) {
+        result.try_emplace(regulator.regulated_object(), sequence++);
+    }
+    return result;
+}
 
-    auto result_it = std::ranges::find_if(regulators, [regulated_object](auto const& regulator) {
-        return regulator.regulated_object() == regulated_object;
-    });
-    assert(result_it != regulators.end());
+template <typename State>
+    requires main_core::component_container_c<typename State::ComponentContainer, TransformerTapRegulator>
+TransformerTapRegulator const& find_regulator(State const& state, RegulatorIndex const& regulator_index,
+                                              ID regulated_object) {
+    auto const result_it = regulator_index.find(regulated_object);
+    assert(result_it != regulator_index.end());
 
-    return *result_it;
+    return main_core::get_component_by_sequence<TransformerTapRegulator>(state, result_it->second);
 }
 
 template <typename... Ts> struct transformer_types_s;
@@ -418,10 +433,11 @@ template <typename... Ts> using transformer_types_t = typename transformer_types
 
 template <transformer_c... TransformerTypes, typename State>
     requires(main_core::component_container_c<typename State::ComponentContainer, TransformerTypes> && ...)
-inline TapRegulatorRef<TransformerTypes...> regulator_mapping(State const& state, Idx2D const& transformer_index) {
+inline TapRegulatorRef<TransformerTypes...> regulator_mapping(State const& state, RegulatorIndex const& regulator_index,
+                                                              Idx2D const& transformer_index) {
     using ResultType = TapRegulatorRef<TransformerTypes...>;
     using IsType = bool (*)(Idx2D const&);
-    using TransformerMapping = ResultType (*)(State const&, Idx2D const&);
+    using TransformerMapping = ResultType (*)(State const&, RegulatorIndex const&, Idx2D const&);
 
     constexpr auto n_types = sizeof...(TransformerTypes);
     constexpr auto is_type = std::array<IsType, n_types>{[](Idx2D const& index) {
@@ -429,9 +445,10 @@ inline TapRegulatorRef<TransformerTypes...> regulator_mapping(State const& state
         return index.group == group_idx;
     }...};
     constexpr auto transformer_mappings =
-        std::array<TransformerMapping, n_types>{[](State const& state_, Idx2D const& transformer_index_) {
+        std::array<TransformerMapping, n_types>{[](State const& state_, RegulatorIndex const& regulator_index_,
+                                                   Idx2D const& transformer_index_) {
             auto const& transformer = get_component<TransformerTypes>(state_, transformer_index_);
-            auto const& regulator = find_regulator(state_, transformer.id());
+            auto const& regulator = find_regulator(state_, regulator_index_, transformer.id());
 
             assert(transformer.status(transformer.tap_side()));
             assert(transformer.status(static_cast<typename TransformerTypes::SideType>(regulator.control_side())));
@@ -443,7 +460,7 @@ inline TapRegulatorRef<TransformerTypes...> regulator_mapping(State const& state
 
     for (Idx idx = 0; idx < static_cast<Idx>(n_types); ++idx) {
         if (is_type[idx](transformer_index)) {
-            return transformer_mappings[idx](state, transformer_index);
+            return transformer_mappings[idx](state, regulator_index, transformer_index);
         }
     }
     throw UnreachableHit{"TapPositionOptimizer::regulator_mapping", "Transformer must be regulated"};
@@ -451,12 +468,13 @@ inline TapRegulatorRef<TransformerTypes...> regulator_mapping(State const& state
 
 template <transformer_c... TransformerTypes, typename State>
     requires(main_core::component_container_c<typename State::ComponentContainer, TransformerTypes> && ...)
-inline auto regulator_mapping(State const& state, std::vector<Idx2D> const& order) {
+inline auto regulator_mapping(State const& state, RegulatorIndex const& regulator_index,
+                              std::vector<Idx2D> const& order) {
     std::vector<TapRegulatorRef<TransformerTypes...>> result;
     result.reserve(order.size());
 
     for (auto const& index : order) {
-        result.push_back(regulator_mapping<TransformerTypes...>(state, index));
+        result.push_back(regulator_mapping<TransformerTypes...>(state, regulator_index, index));
     }
 
     return result;
@@ -464,17 +482,90 @@ inline auto regulator_mapping(State const& state, std::vector<Idx2D> const& orde
 
 template <transformer_c... TransformerTypes, typename State>
     requires(main_core::component_container_c<typename State::ComponentContainer, TransformerTypes> && ...)
-inline auto regulator_mapping(State const& state, RankedTransformerGroups const& order) {
+inline auto regulator_mapping(State const& state, RegulatorIndex const& regulator_index,
+                              RankedTransformerGroups const& order) {
     std::vector<std::vector<TapRegulatorRef<TransformerTypes...>>> result;
     result.reserve(order.size());
 
     for (auto const& sub_order : order) {
-        result.push_back(regulator_mapping<TransformerTypes...>(state, sub_order));
+        result.push_back(regulator_mapping<TransformerTypes...>(state, regulator_index, sub_order));
     }
 
     return result;
 }
 
+// statuses that determine the transformer ranking: the connections of the branches and sources,
+//    and the regulators that are enabled
+template <main_core::main_model_state_c State>
+inline void get_ranking_statuses(State const& state, std::vector<bool>& statuses) {
+    using ComponentContainer = typename State::ComponentContainer;
+
+    statuses.clear();
+    if constexpr (main_core::component_container_c<ComponentContainer, Branch>) {
+        for (auto const& branch : get_component_citer<Branch>(state)) {
+            statuses.push_back(branch.from_status());
+            statuses.push_back(branch.to_status());
+        }
+    }
+    if constexpr (main_core::component_container_c<ComponentContainer, Branch3>) {
+        for (auto const& branch3 : get_component_citer<Branch3>(state)) {
+            statuses.push_back(branch3.status_1());
+            statuses.push_back(branch3.status_2());
+            statuses.push_back(branch3.status_3());
+        }
+    }
+    if constexpr (main_core::component_container_c<ComponentContainer, Source>) {
+        for (auto const& source : get_component_citer<Source>(state)) {
+            statuses.push_back(source.status());
+        }
+    }
+    if constexpr (main_core::component_container_c<ComponentContainer, Regulator>) {
+        for (auto const& regulator : get_component_citer<Regulator>(state)) {
+            statuses.push_back(regulator.status());
+        }
+    }
+}
+
+// ranked regulated transformers and regulator index of the last optimization
+//    the ranking only depends on the topology and the regulators, so it is reused in subsequent optimizations
+//    (e.g. the scenarios of a batch) as long as none of the statuses in the grid changes
+// the optimized tap positions of the last optimization are kept as well, in the ranked order,
+//    to start the tap position search of the next optimization from
+class RegulatorOrderCache {
+  public:
+    template <main_core::main_model_state_c State, typename TransformerRanker>
+    void refresh(State const& state, TransformerRanker const& ranker) {
+        get_ranking_statuses(state, new_statuses_);
+        if (is_valid_ && new_statuses_ == statuses_) {
+            return;
+        }
+        order_ = ranker(state);
+        regulator_index_ = build_regulator_index(state);
+        statuses_.swap(new_statuses_);
+        tap_positions_.clear();
+        is_valid_ = true;
+    }
+
+    RankedTransformerGroups const& order() const { return order_; }
+    RegulatorIndex const& regulator_index() const { return regulator_index_; }
+
+    // empty if there is no optimization with the current order yet
+    std::vector<IntS> const& tap_positions() const { return tap_positions_; }
+    void set_tap_positions(TransformerTapPositionOutput const& tap_positions) {
+        tap_positions_.resize(tap_positions.size());
+        std::ranges::transform(tap_positions, tap_positions_.begin(),
+                               [](TransformerTapPosition const& tap_position) { return tap_position.tap_position; });
+    }
+
+  private:
+    bool is_valid_{false};
+    std::vector<bool> statuses_;
+    std::vector<bool> new_statuses_;
+    RankedTransformerGroups order_;
+    RegulatorIndex regulator_index_;
+    std::vector<IntS> tap_positions_;
+};
+
 template <std::derived_from<Branch> ComponentType, steady_state_solver_output_type SolverOutputType>
 inline auto i_pu(std::vector<SolverOutputType> const& solver_output, Idx2D const& math_id, ControlSide control_side) {
     using enum ControlSide;
@@ -562,10 +653,107 @@ template <symmetry_tag sym> struct NodeState {
     ComplexValue<sym> u;
     ComplexValue<sym> i;
 
+    double compensated_voltage(TransformerTapRegulatorCalcParam const& param) const {
+        auto const u_compensated = u + param.z_compensation * i;
+        return mean_val(cabs(u_compensated)); // TODO(mgovers): handle asym correctly
+    }
+
     friend auto operator<=>(NodeState<sym> state, TransformerTapRegulatorCalcParam const& param) {
-        auto const u_compensated = state.u + param.z_compensation * state.i;
-        auto const v_compensated = mean_val(cabs(u_compensated)); // TODO(mgovers): handle asym correctly
-        return v_compensated <=> VoltageBand{.u_set = param.u_set, .u_band = param.u_band};
+        return state.compensated_voltage(param) <=> VoltageBand{.u_set = param.u_set, .u_band = param.u_band};
+    }
+};
+
+// number of tap steps from tap_min to tap_max
+inline Idx tap_step_count(transformer_c auto const& transformer) {
+    return std::abs(static_cast<Idx>(transformer.tap_max()) - static_cast<Idx>(transformer.tap_min()));
+}
+// number of tap steps from tap_min to the current tap position
+//    the control side voltage decreases with the tap step
+inline Idx tap_step(transformer_c auto const& transformer) {
+    return std::abs(static_cast<Idx>(transformer.tap_pos()) - static_cast<Idx>(transformer.tap_min()));
+}
+inline IntS tap_pos_at_step(transformer_c auto const& transformer, Idx step) {
+    auto const tap_min = static_cast<Idx>(transformer.tap_min());
+    return static_cast<IntS>(transformer.tap_min() < transformer.tap_max() ? tap_min + step : tap_min - step);
+}
+
+// search of the tap step of one regulated transformer that brings the control side voltage in the voltage band
+//    the search keeps a bracket of the tap steps that can still be in the band, assuming that the control side
+//    voltage decreases monotonically with the tap step
+//    every out-of-band voltage shrinks the bracket, so the search terminates within the number of tap steps
+//    if the other transformers change the voltage so much that the bracket becomes empty, the search falls back
+//    to single steps
+class TapPositionSearch {
+  public:
+    explicit TapPositionSearch(Idx n_steps) : n_steps_{n_steps}, upper_{n_steps} {}
+
+    void restart() { *this = TapPositionSearch{n_steps_}; }
+
+    // binary search for the in-band tap step with the highest or lowest control side voltage
+    Idx bisect(Idx step, std::partial_ordering cmp, bool prefer_high_voltage) {
+        if (cmp == 0) {
+            // in band, continue searching the preferred side
+            if (prefer_high_voltage) {
+                upper_ = step;
+            } else {
+                lower_ = step;
+            }
+            if (lower_ > upper_) {
+                return step;
+            }
+        } else if (!narrow(step, cmp)) {
+            return single_step(step, cmp);
+        }
+        return prefer_high_voltage ? (lower_ + upper_) / 2 : (lower_ + upper_ + 1) / 2;
+    }
+
+    // jump to the tap step that is predicted to give the voltage setpoint
+    //    the sensitivity of the voltage to the tap step is the finite difference with the previous observation
+    Idx predict(Idx step, std::partial_ordering cmp, double voltage, double u_set) {
+        Idx const last_step = std::exchange(last_step_, step);
+        double const last_voltage = std::exchange(last_voltage_, voltage);
+
+        if (cmp == 0) {
+            return step;
+        }
+        if (!narrow(step, cmp)) {
+            return single_step(step, cmp);
+        }
+        if (last_step != no_step && last_step != step && voltage != last_voltage) {
+            double const dv_dstep = (voltage - last_voltage) / static_cast<double>(step - last_step);
+            double const predicted_step = static_cast<double>(step) + std::round((u_set - voltage) / dv_dstep);
+            if (std::isfinite(predicted_step)) {
+                return static_cast<Idx>(
+                    std::clamp(predicted_step, static_cast<double>(lower_), static_cast<double>(upper_)));
+            }
+        }
+        // no sensitivity yet, so take a single step to measure it
+        return single_step(step, cmp);
+    }
+
+  private:
+    static constexpr Idx no_step = -1;
+
+    Idx n_steps_;
+    Idx lower_{0};
+    Idx upper_;
+    Idx last_step_{no_step};
+    double last_voltage_{nan};
+
+    // exclude the current tap step and the tap steps beyond it from the bracket
+    //    return false if there is no tap step left in the bracket
+    bool narrow(Idx step, std::partial_ordering cmp) {
+        if (cmp > 0) { // NOLINT(modernize-use-nullptr)
+            // voltage too high, go to a higher tap step
+            lower_ = std::max(lower_, step + 1);
+        } else {
+            upper_ = std::min(upper_, step - 1);
+        }
+        return lower_ <= upper_;
+    }
+
+    Idx single_step(Idx step, std::partial_ordering cmp) const {
+        return std::clamp(cmp > 0 ? step + 1 : step - 1, Idx{0}, n_steps_); // NOLINT(modernize-use-nullptr)
     }
 };
 
@@ -592,7 +780,8 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
     std::vector<uint64_t> max_tap_ranges_per_rank{};
     using ComponentContainer = typename State::ComponentContainer;
     using RegulatedTransformer = TapRegulatorRef<TransformerTypes...>;
-    using UpdateBuffer = std::tuple<std::vector<typename TransformerTypes::UpdateType>...>;
+    using TapPositionSearches = std::vector<std::vector<TapPositionSearch>>;
+    using UpdateBuffer = std::tuple<ComponentUpdate<TransformerTypes>...>;
 
     template <transformer_c T>
     static constexpr auto transformer_index_of = container_impl::get_cls_pos_v<T, TransformerTypes...>;
@@ -600,15 +789,29 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
 
   public:
     TapPositionOptimizerImpl(Calculator calculator, StateUpdater updater, OptimizerStrategy strategy,
-                             meta_data::MetaData const& meta_data)
-        : meta_data_{&meta_data}, calculate_{std::move(calculator)}, update_{std::move(updater)}, strategy_{strategy} {}
+                             meta_data::MetaData const& meta_data, RegulatorOrderCache* order_cache = nullptr,
+                             bool warm_start = false)
+        : meta_data_{&meta_data},
+          calculate_{std::move(calculator)},
+          update_{std::move(updater)},
+          strategy_{strategy},
+          order_cache_{order_cache},
+          warm_start_{warm_start} {}
 
     auto optimize(State const& state, CalculationMethod method) -> MathOutput<ResultType> final {
-        auto const order = regulator_mapping<TransformerTypes...>(state, TransformerRanker{}(state));
+        RegulatorOrderCache local_order_cache;
+        auto& order_cache = order_cache_ != nullptr ? *order_cache_ : local_order_cache;
+        order_cache.refresh(state, TransformerRanker{});
+        auto const order =
+            regulator_mapping<TransformerTypes...>(state, order_cache.regulator_index(), order_cache.order());
         auto const cache = this->cache_states(order);
         try {
             opt_prep(order);
+            if (warm_start_) {
+                warm_start(order, order_cache.tap_positions());
+            }
             auto result = optimize(state, order, method);
+            order_cache.set_tap_positions(result.optimizer_output.transformer_tap_positions);
             update_state(cache);
             return result;
         } catch (...) {
@@ -640,13 +843,16 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
                   CalculationMethod method) const -> MathOutput<ResultType> {
         pilot_run(regulator_order);
 
-        if (auto result = iterate_with_fallback(state, regulator_order, method); strategy_ == OptimizerStrategy::any) {
+        auto search = make_tap_position_search(regulator_order);
+        if (auto result = iterate_with_fallback(state, regulator_order, method, search);
+            strategy_ == OptimizerStrategy::any || strategy_ == OptimizerStrategy::fast_any) {
             return produce_output(regulator_order, std::move(result));
         }
 
         // refine solution
+        //    the search continues in the brackets of the first pass, so only the neighboring tap steps are tried
         exploit_neighborhood(regulator_order);
-        return produce_output(regulator_order, iterate_with_fallback(state, regulator_order, method));
+        return produce_output(regulator_order, iterate_with_fallback(state, regulator_order, method, search));
     }
 
     auto produce_output(std::vector<std::vector<RegulatedTransformer>> const& regulator_order,
@@ -667,14 +873,16 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
 
     auto iterate_with_fallback(State const& state,
                                std::vector<std::vector<RegulatedTransformer>> const& regulator_order,
-                               CalculationMethod method) const -> ResultType {
-        auto fallback = [this, &state, &regulator_order, &method] {
-            std::ignore = iterate(state, regulator_order, CalculationMethod::linear);
-            return iterate(state, regulator_order, method);
+                               CalculationMethod method, TapPositionSearches& search) const -> ResultType {
+        auto fallback = [this, &state, &regulator_order, &method, &search] {
+            search = make_tap_position_search(regulator_order);
+            std::ignore = iterate(state, regulator_order, CalculationMethod::linear, search);
+            search = make_tap_position_search(regulator_order);
+            return iterate(state, regulator_order, method, search);
         };
 
         try {
-            return iterate(state, regulator_order, method);
+            return iterate(state, regulator_order, method, search);
         } catch (IterationDiverge const& /* ex */) {
             return fallback();
         } catch (SparseMatrixError const& /* ex */) {
@@ -683,7 +891,7 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
     }
 
     auto iterate(State const& state, std::vector<std::vector<RegulatedTransformer>> const& regulator_order,
-                 CalculationMethod method) const -> ResultType {
+                 CalculationMethod method, TapPositionSearches& search) const -> ResultType {
         auto result = calculate_(state, method);
 
         std::vector<IntS> iterations_per_rank(static_cast<signed char>(regulator_order.size() + 1),
@@ -695,9 +903,13 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
             UpdateBuffer update_data;
             size_t rank_index = 0;
 
-            for (auto const& same_rank_regulators : regulator_order) {
-                for (auto const& regulator : same_rank_regulators) {
-                    tap_changed = adjust_transformer(regulator, state, result, update_data) || tap_changed;
+            for (size_t rank = 0; rank < regulator_order.size(); ++rank) {
+                auto const& same_rank_regulators = regulator_order[rank];
+                auto& same_rank_search = search[rank];
+                for (size_t i = 0; i < same_rank_regulators.size(); ++i) {
+                    tap_changed = adjust_transformer(same_rank_regulators[i], same_rank_search[i], state, result,
+                                                     update_data) ||
+                                  tap_changed;
                 }
                 if (tap_changed) {
                     break;
@@ -705,20 +917,46 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
                 iterations_per_rank[++rank_index] = 0; // NOSONAR
             }
             if (tap_changed) {
+                // the voltages of the lower ranks change, so their search starts over
+                for (auto& same_rank_search : search | std::views::drop(rank_index + 1)) {
+                    std::ranges::for_each(same_rank_search, &TapPositionSearch::restart);
+                }
                 if (static_cast<uint64_t>(++iterations_per_rank[rank_index]) >
                     2 * max_tap_ranges_per_rank[rank_index]) {
                     throw MaxIterationReached{"TapPositionOptimizer::iterate"};
                 }
                 update_state(update_data);
-                result = calculate_(state, method);
+                result = calculate_from(state, method, result);
             }
         }
 
         return result;
     }
 
-    bool adjust_transformer(RegulatedTransformer const& regulator, State const& state, ResultType const& solver_output,
-                            UpdateBuffer& update_data) const {
+    // a single tap step barely changes the voltages, so the previous result is a good initial guess
+    auto calculate_from(State const& state, CalculationMethod method, ResultType const& previous_result) const
+        -> ResultType {
+        if constexpr (detail::warm_start_calculator_c<Calculator, State>) {
+            return calculate_(state, method, previous_result);
+        } else {
+            return calculate_(state, method);
+        }
+    }
+
+    static auto make_tap_position_search(std::vector<std::vector<RegulatedTransformer>> const& regulator_order) {
+        TapPositionSearches result(regulator_order.size());
+        for (size_t rank = 0; rank < regulator_order.size(); ++rank) {
+            result[rank].reserve(regulator_order[rank].size());
+            for (auto const& regulator : regulator_order[rank]) {
+                result[rank].emplace_back(regulator.transformer.apply(
+                    [](transformer_c auto const& transformer) { return tap_step_count(transformer); }));
+            }
+        }
+        return result;
+    }
+
+    bool adjust_transformer(RegulatedTransformer const& regulator, TapPositionSearch& search, State const& state,
+                            ResultType const& solver_output, UpdateBuffer& update_data) const {
         bool tap_changed = false;
 
         regulator.transformer.apply([&](transformer_c auto const& transformer) {
@@ -731,7 +969,25 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
                                .i = i_pu_controlled_node<TransformerType>(regulator, state, solver_output)};
 
             auto const cmp = node_state <=> param;
-            auto new_tap_pos = [&transformer, &cmp] {
+            auto new_tap_pos = [this, &transformer, &cmp, &search, &node_state, &param] {
+                using enum OptimizerStrategy;
+
+                switch (strategy_) {
+                case fast_any:
+                    return tap_pos_at_step(transformer, search.predict(tap_step(transformer), cmp,
+                                                                       node_state.compensated_voltage(param),
+                                                                       param.u_set));
+                case global_maximum:
+                    [[fallthrough]];
+                case local_maximum:
+                    return tap_pos_at_step(transformer, search.bisect(tap_step(transformer), cmp, true));
+                case global_minimum:
+                    [[fallthrough]];
+                case local_minimum:
+                    return tap_pos_at_step(transformer, search.bisect(tap_step(transformer), cmp, false));
+                default:
+                    break;
+                }
                 if (cmp > 0) { // NOLINT(modernize-use-nullptr)
                     return one_step_control_voltage_down(transformer);
                 }
@@ -742,7 +998,7 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
             }();
 
             if (new_tap_pos != transformer.tap_pos()) {
-                add_tap_pos_update(new_tap_pos, transformer, update_data);
+                add_tap_pos_update(new_tap_pos, transformer, regulator.transformer.index(), update_data);
                 tap_changed = true;
             }
         });
@@ -754,9 +1010,15 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
         static_assert(sizeof...(TransformerTypes) == std::tuple_size_v<UpdateBuffer>);
 
         ConstDataset update_dataset{false, 1, "update", *meta_data_};
-        auto const update_component = [&update_data, &update_dataset]<transformer_c TransformerType>() {
+        auto const update_component = [this, &update_data, &update_dataset]<transformer_c TransformerType>() {
             auto const& component_update = get<TransformerType>(update_data);
-            if (!component_update.empty()) {
+            if (component_update.updates.empty()) {
+                return;
+            }
+            if constexpr (direct_state_updater_c<StateUpdater, TransformerType>) {
+                // the positions of the transformers are known, so there is no need for a dataset and ID lookup
+                update_(component_update);
+            } else {
                 add_buffer_to_update_dataset<TransformerType>(update_data, TransformerType::name, update_dataset);
             }
         };
@@ -767,6 +1029,27 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
         }
     }
 
+    // start the search from the optimized tap positions of the previous optimization
+    //    only for the strategies that search from the current tap positions
+    void warm_start(std::vector<std::vector<RegulatedTransformer>> const& regulator_order,
+                    std::vector<IntS> const& tap_positions) const {
+        if (strategy_ != OptimizerStrategy::any && strategy_ != OptimizerStrategy::fast_any) {
+            return;
+        }
+        size_t n_regulators{0};
+        for (auto const& same_rank_regulators : regulator_order) {
+            n_regulators += same_rank_regulators.size();
+        }
+        if (tap_positions.size() != n_regulators) {
+            return;
+        }
+        regulate_transformers(
+            [it = tap_positions.cbegin()](transformer_c auto const& /* transformer */) mutable -> IntS {
+                return *it++;
+            },
+            regulator_order);
+    }
+
     auto pilot_run(std::vector<std::vector<RegulatedTransformer>> const& regulator_order) const {
         using namespace std::string_literals;
 
@@ -781,6 +1064,8 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
 
         switch (strategy_) {
         case OptimizerStrategy::any:
+            [[fallthrough]];
+        case OptimizerStrategy::fast_any:
             break;
         case OptimizerStrategy::global_maximum:
             [[fallthrough]];
@@ -809,6 +1094,8 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
 
         switch (strategy_) {
         case OptimizerStrategy::any:
+            [[fallthrough]];
+        case OptimizerStrategy::fast_any:
             break;
         case OptimizerStrategy::global_maximum:
             [[fallthrough]];
@@ -825,11 +1112,14 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
         }
     }
 
-    static auto add_tap_pos_update(IntS new_tap_pos, transformer_c auto const& transformer, UpdateBuffer& update_data) {
+    static auto add_tap_pos_update(IntS new_tap_pos, transformer_c auto const& transformer, Idx2D const& index,
+                                   UpdateBuffer& update_data) {
         auto result = get_nan_update(transformer);
         result.id = transformer.id();
         result.tap_pos = new_tap_pos;
-        get<std::remove_cvref_t<decltype(transformer)>>(update_data).push_back(result);
+        auto& component_update = get<std::remove_cvref_t<decltype(transformer)>>(update_data);
+        component_update.updates.push_back(result);
+        component_update.sequence_idx.push_back(index);
     }
 
     template <typename Func>
@@ -840,13 +1130,13 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
                                std::vector<std::vector<RegulatedTransformer>> const& regulator_order) const {
         UpdateBuffer update_data;
 
-        auto const get_update = [new_tap_pos = std::move(new_tap_pos),
-                                 &update_data](transformer_c auto const& transformer) {
-            add_tap_pos_update(new_tap_pos(transformer), transformer, update_data);
-        };
-
         for (auto const& sub_order : regulator_order) {
             for (auto const& regulator : sub_order) {
+                auto const get_update = [&new_tap_pos, &regulator,
+                                         &update_data](transformer_c auto const& transformer) {
+                    add_tap_pos_update(new_tap_pos(transformer), transformer, regulator.transformer.index(),
+                                       update_data);
+                };
                 regulator.transformer.apply(get_update);
             }
         }
@@ -866,35 +1156,35 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
     static UpdateBuffer cache_states(std::vector<std::vector<RegulatedTransformer>> const& regulator_order) {
         UpdateBuffer result;
 
-        auto const cache_transformer = [&result](transformer_c auto const& transformer) {
-            get<std::remove_cvref_t<decltype(transformer)>>(result).push_back(component_cache_update(transformer));
-        };
-
         for (auto const& same_rank_regulators : regulator_order) {
             for (auto const& regulator_index : same_rank_regulators) {
-                regulator_index.transformer.apply(cache_transformer);
+                regulator_index.transformer.apply([&result, &regulator_index](transformer_c auto const& transformer) {
+                    auto& component_update = get<std::remove_cvref_t<decltype(transformer)>>(result);
+                    component_update.updates.push_back(component_cache_update(transformer));
+                    component_update.sequence_idx.push_back(regulator_index.transformer.index());
+                });
             }
         }
 
         return result;
     }
 
-    template <transformer_c T> static std::vector<typename T::UpdateType>& get(UpdateBuffer& update_data) {
+    template <transformer_c T> static ComponentUpdate<T>& get(UpdateBuffer& update_data) {
         return std::get<transformer_index_of<T>>(update_data);
     }
 
-    template <transformer_c T> static std::vector<typename T::UpdateType> const& get(UpdateBuffer const& update_data) {
+    template <transformer_c T> static ComponentUpdate<T> const& get(UpdateBuffer const& update_data) {
         return std::get<transformer_index_of<T>>(update_data);
     }
 
     template <transformer_c T>
         requires requires(UpdateBuffer const& u) {
-                     { get<T>(u).data() } -> std::convertible_to<void const*>;
-                     { get<T>(u).size() } -> std::convertible_to<Idx>;
+                     { get<T>(u).updates.data() } -> std::convertible_to<void const*>;
+                     { get<T>(u).updates.size() } -> std::convertible_to<Idx>;
                  }
     static auto add_buffer_to_update_dataset(UpdateBuffer const& update_buffer, std::string_view component_name,
                                              ConstDataset& update_data) {
-        auto const& data = get<T>(update_buffer);
+        auto const& data = get<T>(update_buffer).updates;
         update_data.add_buffer(component_name, static_cast<Idx>(data.size()), static_cast<Idx>(data.size()), nullptr,
                                data.data());
     }
@@ -908,6 +1198,8 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
     Calculator calculate_;
     StateUpdater update_;
     OptimizerStrategy strategy_;
+    RegulatorOrderCache* order_cache_;
+    bool warm_start_;
 };
 
 template <typename StateCalculator, typename StateUpdater, main_core::main_model_state_c State,
@@ -79,6 +79,24 @@ typedef struct PGM_Handle PGM_Handle;
  */
 typedef struct PGM_Options PGM_Options;
 
+/**
+ * @brief Opaque struct for the batch reduction class.
+ *
+ * The batch reduction class reduces output attributes over all scenarios of a batch calculation,
+ * e.g. into the maximum value per component.
+ *
+ */
+typedef struct PGM_BatchReduction PGM_BatchReduction;
+
+/**
+ * @brief Opaque struct for the violation screening class.
+ *
+ * The violation screening class collects the output attributes of a batch calculation
+ * which are outside of the given limits, instead of the full batch output.
+ *
+ */
+typedef struct PGM_ViolationScreening PGM_ViolationScreening;
+
 // Only enable the opaque struct definition if this header is consumed by the C-API user.
 // If this header is included when compiling the C-API, the structs below are decleared/defined in the C++ files.
 #ifndef PGM_DLL_EXPORTS
@@ -218,6 +236,20 @@ enum PGM_TapChangingStrategy {
         2, /**< adjust tap position automatically; optimize for the lower end of the voltage band */
     PGM_tap_changing_strategy_max_voltage_tap =
         3, /**< adjust tap position automatically; optimize for the higher end of the voltage band */
+    PGM_tap_changing_strategy_fast_any_tap =
+        4, /**< adjust tap position automatically; optimize for any value in the voltage band; jump to the tap
+              position predicted from the voltage sensitivity */
+};
+
+/**
+ * @brief Enumeration of the statistics of a batch reduction.
+ *
+ */
+enum PGM_ReductionType {
+    PGM_reduction_minimum = 0,    /**< minimum over all scenarios */
+    PGM_reduction_maximum = 1,    /**< maximum over all scenarios */
+    PGM_reduction_mean = 2,       /**< mean over all scenarios */
+    PGM_reduction_percentile = 3, /**< approximate percentile over all scenarios */
 };
 
 /**
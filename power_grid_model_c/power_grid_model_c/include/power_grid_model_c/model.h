@@ -33,6 +33,25 @@ extern "C" {
 PGM_API PGM_PowerGridModel* PGM_create_model(PGM_Handle* handle, double system_frequency,
                                              PGM_ConstDataset const* input_dataset);
 
+/**
+ * @brief Create a new instance of Power Grid Model with options.
+ *
+ * This is the same as PGM_create_model(), except that the options are used for the creation of the model.
+ * Currently only the threading option is used: the components of the different component types
+ * are constructed concurrently, see PGM_set_threading().
+ * The returned model need to be freed by PGM_destroy_model()
+ *
+ * @param handle
+ * @param opt A pointer to options.
+ * @param system_frequency The frequency of the system, usually 50 or 60 Hz
+ * @param input_dataset Pointer to an instance of PGM_ConstDataset. It should have data type "input".
+ * @return The opaque pointer to the created model.
+ * If there are errors during the creation, a NULL is returned.
+ * Use PGM_error_code() and PGM_error_message() to check the error. */
+PGM_API PGM_PowerGridModel* PGM_create_model_with_options(PGM_Handle* handle, PGM_Options const* opt,
+                                                          double system_frequency,
+                                                          PGM_ConstDataset const* input_dataset);
+
 /**
  * @brief Update the model by changing mutable attributes of some elements.
  *
@@ -48,6 +67,43 @@ PGM_API PGM_PowerGridModel* PGM_create_model(PGM_Handle* handle, double system_f
  */
 PGM_API void PGM_update_model(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_ConstDataset const* update_dataset);
 
+/**
+ * @brief Add components to an existing model.
+ *
+ * The components are added as if they were part of the input data of the model.
+ * Their ids should not exist in the model yet.
+ * The topology of the model is rebuilt at the next calculation.
+ * If there are errors, the model is left unchanged.
+ *
+ * Use PGM_error_code() and PGM_error_message() to check if there are errors.
+ *
+ * @param handle
+ * @param model A pointer to an existing model.
+ * @param input_dataset Pointer to an instance of PGM_ConstDataset. It should have data type "input".
+ * @return
+ */
+PGM_API void PGM_add_components(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_ConstDataset const* input_dataset);
+
+/**
+ * @brief Remove components from an existing model.
+ *
+ * The components can be of any type.
+ * A component cannot be removed while a remaining component refers to it,
+ * e.g. a node cannot be removed while a line is connected to it, unless the line is removed as well.
+ * The remaining components keep their order.
+ * The topology of the model is rebuilt at the next calculation.
+ * If there are errors, the model is left unchanged.
+ *
+ * Use PGM_error_code() and PGM_error_message() to check if there are errors.
+ *
+ * @param handle
+ * @param model A pointer to an existing model.
+ * @param size The number of components to remove.
+ * @param ids Pointer to an array of ids of the components to remove.
+ * @return
+ */
+PGM_API void PGM_remove_components(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_Idx size, PGM_ID const* ids);
+
 /**
  * @brief Make a copy of an existing model.
  *
@@ -112,6 +168,323 @@ PGM_API void PGM_get_indexer(PGM_Handle* handle, PGM_PowerGridModel const* model
 PGM_API void PGM_calculate(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_Options const* opt,
                            PGM_MutableDataset const* output_dataset, PGM_ConstDataset const* batch_dataset);
 
+/**
+ * @brief Execute an N-1 contingency power flow, with one scenario per outaged branch or branch3.
+ *
+ * In each scenario, the outaged component is switched off at all sides.
+ * With the linear calculation method and without tap changing,
+ * an outage which does not change the island structure is solved by compensation on the base case,
+ * which is much faster than a regular batch calculation with the outages in the update data.
+ *
+ * Use PGM_error_code() and PGM_error_message() to check the error.
+ *
+ * @param handle
+ * @param model A pointer to an existing model.
+ * @param opt A pointer to options, you need to pre-set all the calculation options you want.
+ *   The calculation type should be power flow.
+ * @param output_dataset A pointer to an instance of PGM_MutableDataset.
+ *   The dataset should have is_batch == true and type "sym_output" or "asym_output".
+ *   The batch size should be equal to the number of outages.
+ *   You need to pre-allocate all output memory buffers.
+ * @param n_outages The number of outages.
+ * @param outage_ids A pointer to an array of the ids of the outaged branches or branch3s.
+ * @return
+ */
+PGM_API void PGM_calculate_contingency(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_Options const* opt,
+                                       PGM_MutableDataset const* output_dataset, PGM_Idx n_outages,
+                                       PGM_ID const* outage_ids);
+
+/**
+ * @brief Check the observability of a one-time or batch state estimation, without solving it.
+ *
+ * The check only depends on the topology and the sensors, so it is much faster than the state estimation itself.
+ * It can be used as a pre-pass to find the scenarios of a batch which cannot be estimated.
+ * A state estimation does the same check before the calculation of each scenario.
+ *
+ * Use PGM_error_code() and PGM_error_message() to check the error.
+ * If the model is not observable, the error code is PGM_regular_error.
+ * If some scenarios of a batch are not observable, the error code is PGM_batch_error,
+ * use PGM_failed_scenarios() and PGM_batch_errors() to get the unobservable scenarios.
+ *
+ * @param handle
+ * @param model A pointer to an existing model.
+ * @param opt A pointer to options, the symmetry and the threading options are used.
+ * @param batch_dataset A pointer to an instance of PGM_ConstDataset for a batch check.
+ *   Or NULL for a one-time check.
+ *   The dataset should have is_batch == true. The type of the dataset should be "update".
+ * @return
+ */
+PGM_API void PGM_check_observability(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_Options const* opt,
+                                     PGM_ConstDataset const* batch_dataset);
+
+/**
+ * @brief Callback to hand over the results of one chunk of a streaming batch calculation.
+ *
+ * @param user_data The user data pointer as provided to PGM_calculate_streaming().
+ * @param chunk_start The index of the first scenario of the chunk in the whole batch.
+ * @param chunk_size The number of scenarios in the chunk.
+ *   Only the first chunk_size scenarios of output_chunk contain results.
+ * @param output_chunk The output chunk containing the results, as provided to PGM_calculate_streaming().
+ */
+typedef void (*PGM_BatchChunkCallback)(void* user_data, PGM_Idx chunk_start, PGM_Idx chunk_size,
+                                       PGM_MutableDataset const* output_chunk);
+
+/**
+ * @brief Execute a batch calculation, streaming the results chunk by chunk.
+ *
+ * The scenarios are calculated in chunks with the batch size of the output chunks.
+ * Chunk k is written to output_chunks[k % n_output_chunks] and handed over to the callback.
+ * The calculation of the next chunk continues while the callback is running.
+ * Therefore, the memory needed for the output does not scale with the batch size.
+ *
+ * The callback is called from a different thread than the calling thread, but never concurrently with itself.
+ * The content of an output chunk is only valid until the callback returns.
+ * If only one output chunk is provided, the calculation waits for the callback before continuing.
+ *
+ * Use PGM_error_code() and PGM_error_message() to check the error.
+ *
+ * @param handle
+ * @param model A pointer to an existing model.
+ * @param opt A pointer to options, you need to pre-set all the calculation options you want.
+ * @param n_output_chunks The number of output chunks, should be at least one.
+ * @param output_chunks An array of pointers to instances of PGM_MutableDataset.
+ *   All output chunks should be batch datasets of the same batch size, which is used as the chunk size.
+ *   The dataset should have type "*_output", depending on the type of dataset.
+ * @param batch_dataset A pointer to an instance of PGM_ConstDataset for batch calculation.
+ *   Or NULL for single calculation, which is handed over as one chunk containing one scenario.
+ *   The dataset should have is_batch == true. The type of the dataset should be "update".
+ * @param callback The callback which is called for each finished chunk, should not be NULL.
+ * @param user_data A pointer which is passed to the callback as is.
+ * @return
+ */
+PGM_API void PGM_calculate_streaming(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_Options const* opt,
+                                     PGM_Idx n_output_chunks, PGM_MutableDataset const** output_chunks,
+                                     PGM_ConstDataset const* batch_dataset, PGM_BatchChunkCallback callback,
+                                     void* user_data);
+
+/**
+ * @brief Callback to provide the update data of one chunk of a streaming batch calculation.
+ *
+ * @param user_data The user data pointer as provided to PGM_calculate_streaming_updates().
+ * @param chunk_start The index of the first scenario of the chunk in the whole batch.
+ * @param chunk_size The number of scenarios in the chunk.
+ * @return A pointer to an instance of PGM_ConstDataset with the update data of the chunk.
+ *   The dataset should have is_batch == true and a batch size of exactly chunk_size.
+ *   The type of the dataset should be "update".
+ *   The dataset and its buffers should stay valid until the next call of the callback,
+ *   or until PGM_calculate_streaming_updates() returns.
+ *   Return NULL to abort the calculation with an error.
+ */
+typedef PGM_ConstDataset const* (*PGM_UpdateChunkCallback)(void* user_data, PGM_Idx chunk_start,
+                                                            PGM_Idx chunk_size);
+
+/**
+ * @brief Execute a batch calculation, streaming both the update data and the results chunk by chunk.
+ *
+ * This is the same as PGM_calculate_streaming(),
+ * except that the update data of each chunk is requested from update_callback just before the chunk is calculated.
+ * Therefore, neither the memory needed for the update data nor for the output scales with the batch size.
+ *
+ * The update callback is called from the calling thread.
+ * It can be called while the output callback of the previous chunk is still running.
+ *
+ * Use PGM_error_code() and PGM_error_message() to check the error.
+ *
+ * @param handle
+ * @param model A pointer to an existing model.
+ * @param opt A pointer to options, you need to pre-set all the calculation options you want.
+ * @param n_output_chunks The number of output chunks, should be at least one.
+ * @param output_chunks An array of pointers to instances of PGM_MutableDataset.
+ *   All output chunks should be batch datasets of the same batch size, which is used as the chunk size.
+ *   The dataset should have type "*_output", depending on the type of dataset.
+ * @param n_scenarios The total number of scenarios of the batch.
+ * @param update_callback The callback which provides the update data of each chunk.
+ * @param update_user_data A pointer which is passed to the update callback as is.
+ * @param callback The callback which is called for each finished chunk, should not be NULL.
+ * @param user_data A pointer which is passed to the callback as is.
+ * @return
+ */
+PGM_API void PGM_calculate_streaming_updates(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_Options const* opt,
+                                             PGM_Idx n_output_chunks, PGM_MutableDataset const** output_chunks,
+                                             PGM_Idx n_scenarios, PGM_UpdateChunkCallback update_callback,
+                                             void* update_user_data, PGM_BatchChunkCallback callback,
+                                             void* user_data);
+
+/**
+ * @brief Create a new batch reduction without rules.
+ *
+ * The returned batch reduction need to be freed by PGM_destroy_batch_reduction()
+ *
+ * @param handle
+ * @return The opaque pointer to the created batch reduction.
+ * If there are errors during the creation, a NULL is returned.
+ * Use PGM_error_code() and PGM_error_message() to check the error.
+ */
+PGM_API PGM_BatchReduction* PGM_create_batch_reduction(PGM_Handle* handle);
+
+/**
+ * @brief Add a rule to a batch reduction.
+ *
+ * A rule reduces one output attribute of one component type over all scenarios of a batch.
+ * The attribute should be of type double or double3, nan values are skipped.
+ * The rules are numbered in the order in which they are added, starting at 0.
+ *
+ * Use PGM_error_code() and PGM_error_message() to check if the rule is invalid.
+ *
+ * @param handle
+ * @param reduction A pointer to an existing batch reduction.
+ * @param component The name of the component, e.g. "node".
+ * @param attribute The name of the output attribute, e.g. "u_pu".
+ * @param type The statistic of the rule, see #PGM_ReductionType.
+ * @param percentile The percentile in percent, only used for #PGM_reduction_percentile.
+ * @param lower The lower end of the histogram range, only used for #PGM_reduction_percentile.
+ * @param upper The upper end of the histogram range, only used for #PGM_reduction_percentile.
+ * @param n_bins The number of equidistant histogram bins between lower and upper,
+ *   only used for #PGM_reduction_percentile. The error of the percentile is at most one bin width.
+ *   At most 1000 bins are allowed, because each thread keeps the counts of all bins of all values.
+ * @return
+ */
+PGM_API void PGM_batch_reduction_add_rule(PGM_Handle* handle, PGM_BatchReduction* reduction, char const* component,
+                                          char const* attribute, PGM_Idx type, double percentile, double lower,
+                                          double upper, PGM_Idx n_bins);
+
+/**
+ * @brief Execute a batch calculation, reducing the results on the fly instead of writing batch output.
+ *
+ * The calculation type and symmetry of the options determine the output dataset of which the attributes are reduced.
+ * The reduced values of a scenario which fails are not part of the result.
+ * The result is retrieved with PGM_batch_reduction_result().
+ *
+ * Use PGM_error_code() and PGM_error_message() to check the error.
+ *
+ * @param handle
+ * @param model A pointer to an existing model.
+ * @param opt A pointer to options, you need to pre-set all the calculation options you want.
+ * @param reduction A pointer to an existing batch reduction.
+ * @param batch_dataset A pointer to an instance of PGM_ConstDataset for batch calculation.
+ *   The dataset should have is_batch == true. The type of the dataset should be "update".
+ * @return
+ */
+PGM_API void PGM_calculate_reduced(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_Options const* opt,
+                                   PGM_BatchReduction* reduction, PGM_ConstDataset const* batch_dataset);
+
+/**
+ * @brief Get the reduced values of a rule of the last batch calculation.
+ *
+ * For each component in the order of the input data, there are values_per_element consecutive values,
+ * which is 3 for attributes of type double3 and 1 otherwise.
+ * The value is nan if there is no valid value for the component in any scenario.
+ *
+ * @param handle
+ * @param reduction A pointer to an existing batch reduction.
+ * @param rule The number of the rule.
+ * @param values_per_element Output argument: the number of values per component will be written to it.
+ * @param size Output argument: the total number of values will be written to it.
+ * @return The pointer to the reduced values, owned by the batch reduction.
+ * It stays valid until the next calculation or the destruction of the batch reduction.
+ * If the rule does not exist or there is no result yet, a NULL is returned.
+ * Use PGM_error_code() and PGM_error_message() to check the error.
+ */
+PGM_API double const* PGM_batch_reduction_result(PGM_Handle* handle, PGM_BatchReduction const* reduction,
+                                                 PGM_Idx rule, PGM_Idx* values_per_element, PGM_Idx* size);
+
+/**
+ * @brief Destroy the batch reduction returned by PGM_create_batch_reduction().
+ *
+ * @param reduction The pointer to the batch reduction.
+ */
+PGM_API void PGM_destroy_batch_reduction(PGM_BatchReduction* reduction);
+
+/**
+ * @brief Create a new violation screening without rules.
+ *
+ * The returned violation screening need to be freed by PGM_destroy_violation_screening()
+ *
+ * @param handle
+ * @return The opaque pointer to the created violation screening.
+ * If there are errors during the creation, a NULL is returned.
+ * Use PGM_error_code() and PGM_error_message() to check the error.
+ */
+PGM_API PGM_ViolationScreening* PGM_create_violation_screening(PGM_Handle* handle);
+
+/**
+ * @brief Add a rule to a violation screening.
+ *
+ * A rule screens one output attribute of one component type in all scenarios of a batch.
+ * A value violates the rule if it is strictly below lower or strictly above upper.
+ * The attribute should be of type double or double3, nan values never violate a rule.
+ * The rules are numbered in the order in which they are added, starting at 0.
+ *
+ * Use PGM_error_code() and PGM_error_message() to check if the rule is invalid.
+ *
+ * @param handle
+ * @param screening A pointer to an existing violation screening.
+ * @param component The name of the component, e.g. "node".
+ * @param attribute The name of the output attribute, e.g. "u_pu".
+ * @param lower The lower limit, use -inf for no lower limit.
+ * @param upper The upper limit, use +inf for no upper limit. It should not be smaller than lower.
+ * @return
+ */
+PGM_API void PGM_violation_screening_add_rule(PGM_Handle* handle, PGM_ViolationScreening* screening,
+                                              char const* component, char const* attribute, double lower,
+                                              double upper);
+
+/**
+ * @brief Execute a batch calculation, only collecting the violations of the rules instead of writing batch output.
+ *
+ * The calculation type and symmetry of the options determine the output dataset of which the attributes are screened.
+ * The violations of a scenario which fails are not part of the result.
+ * The result is retrieved with PGM_violation_screening_n_violations() and PGM_violation_screening_result().
+ *
+ * Use PGM_error_code() and PGM_error_message() to check the error.
+ *
+ * @param handle
+ * @param model A pointer to an existing model.
+ * @param opt A pointer to options, you need to pre-set all the calculation options you want.
+ * @param screening A pointer to an existing violation screening.
+ * @param batch_dataset A pointer to an instance of PGM_ConstDataset for batch calculation.
+ *   The dataset should have is_batch == true. The type of the dataset should be "update".
+ * @return
+ */
+PGM_API void PGM_calculate_screened(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_Options const* opt,
+                                    PGM_ViolationScreening* screening, PGM_ConstDataset const* batch_dataset);
+
+/**
+ * @brief Get the number of violations of the last batch calculation.
+ *
+ * @param handle
+ * @param screening A pointer to an existing violation screening.
+ * @return The number of violations, 0 if there is no calculation yet.
+ */
+PGM_API PGM_Idx PGM_violation_screening_n_violations(PGM_Handle* handle, PGM_ViolationScreening const* screening);
+
+/**
+ * @brief Copy the violations of the last batch calculation into the user provided buffers.
+ *
+ * The violations are sorted by scenario. Within a scenario, they are ordered by rule,
+ * component in the order of the input data and phase.
+ * Each buffer should have the size of PGM_violation_screening_n_violations(), or be NULL to skip the field.
+ *
+ * @param handle
+ * @param screening A pointer to an existing violation screening.
+ * @param scenarios Output buffer for the scenario of each violation.
+ * @param ids Output buffer for the id of the violating component.
+ * @param rules Output buffer for the number of the violated rule.
+ * @param phases Output buffer for the phase, 0 for attributes of type double and the phase index for double3.
+ * @param values Output buffer for the violating value.
+ * @return
+ */
+PGM_API void PGM_violation_screening_result(PGM_Handle* handle, PGM_ViolationScreening const* screening,
+                                            PGM_Idx* scenarios, PGM_ID* ids, PGM_Idx* rules, PGM_Idx* phases,
+                                            double* values);
+
+/**
+ * @brief Destroy the violation screening returned by PGM_create_violation_screening().
+ *
+ * @param screening The pointer to the violation screening.
+ */
+PGM_API void PGM_destroy_violation_screening(PGM_ViolationScreening* screening);
+
 /**
  * @brief Destroy the model returned by PGM_create_model() or PGM_copy_model().
  *
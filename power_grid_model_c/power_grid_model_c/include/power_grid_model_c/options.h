@@ -91,7 +91,10 @@ PGM_API void PGM_set_err_tol(PGM_Handle* handle, PGM_Options* opt, double err_to
 PGM_API void PGM_set_max_iter(PGM_Handle* handle, PGM_Options* opt, PGM_Idx max_iter);
 
 /**
- * @brief Specify the multi-threading strategy. Only applicable for batch calculation.
+ * @brief Specify the multi-threading strategy.
+ *
+ * Applicable for batch calculations, for the islands of a single power flow calculation,
+ * and for the construction of the components of a model in PGM_create_model_with_options().
  *
  * @param handle
  * @param opt The pointer to the option instance.
@@ -121,6 +124,21 @@ PGM_API void PGM_set_short_circuit_voltage_scaling(PGM_Handle* handle, PGM_Optio
  */
 PGM_API void PGM_set_tap_changing_strategy(PGM_Handle* handle, PGM_Options* opt, PGM_Idx tap_changing_strategy);
 
+/**
+ * @brief Specify whether the tap changing starts from the optimized tap positions of the previous calculation.
+ *
+ * In a batch calculation, the previous calculation is the previous scenario calculated by the same thread.
+ * This speeds up time series calculations, in which the optimal tap positions change slowly.
+ * The input tap positions of the model are not changed.
+ * Only applicable to the strategies that search from the current tap positions,
+ * i.e. #PGM_tap_changing_strategy_any_valid_tap and #PGM_tap_changing_strategy_fast_any_tap.
+ *
+ * @param handle
+ * @param opt pointer to option instance
+ * @param warm_start 0: start from the input tap positions (default), 1: start from the previous optimum
+ */
+PGM_API void PGM_set_tap_changing_warm_start(PGM_Handle* handle, PGM_Options* opt, PGM_Idx warm_start);
+
 /**
  * @brief Enable/disable experimental features.
  *
@@ -14,6 +14,13 @@
 #include <power_grid_model/common/common.hpp>
 #include <power_grid_model/main_model.hpp>
 
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <vector>
+
 namespace {
 using namespace power_grid_model;
 } // namespace
@@ -23,6 +30,18 @@ struct PGM_PowerGridModel : public MainModel {
     using MainModel::MainModel;
 };
 
+// batch reduction with its rules, the reduction is recreated for each calculation
+struct PGM_BatchReduction {
+    std::vector<BatchReductionRule> rules;
+    BatchReduction reduction{{}};
+};
+
+// violation screening with its rules, the screening is recreated for each calculation
+struct PGM_ViolationScreening {
+    std::vector<ViolationRule> rules;
+    ViolationScreening screening{{}};
+};
+
 // create model
 PGM_PowerGridModel* PGM_create_model(PGM_Handle* handle, double system_frequency,
                                      PGM_ConstDataset const* input_dataset) {
@@ -34,6 +53,17 @@ PGM_PowerGridModel* PGM_create_model(PGM_Handle* handle, double system_frequency
         PGM_regular_error);
 }
 
+// create model with options
+PGM_PowerGridModel* PGM_create_model_with_options(PGM_Handle* handle, PGM_Options const* opt,
+                                                  double system_frequency, PGM_ConstDataset const* input_dataset) {
+    return call_with_catch(
+        handle,
+        [opt, system_frequency, input_dataset] {
+            return new PGM_PowerGridModel{system_frequency, *input_dataset, 0, opt->threading};
+        },
+        PGM_regular_error);
+}
+
 // update model
 void PGM_update_model(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_ConstDataset const* update_dataset) {
     call_with_catch(
@@ -41,6 +71,18 @@ void PGM_update_model(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_ConstDa
         PGM_regular_error);
 }
 
+// add components
+void PGM_add_components(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_ConstDataset const* input_dataset) {
+    call_with_catch(handle, [model, input_dataset] { model->add_components(*input_dataset); }, PGM_regular_error);
+}
+
+// remove components
+void PGM_remove_components(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_Idx size, PGM_ID const* ids) {
+    call_with_catch(
+        handle, [model, size, ids] { model->remove_components({ids, static_cast<size_t>(size)}); },
+        PGM_regular_error);
+}
+
 // copy model
 PGM_PowerGridModel* PGM_copy_model(PGM_Handle* handle, PGM_PowerGridModel const* model) {
     return call_with_catch(
@@ -86,6 +128,7 @@ constexpr auto get_optimizer_type(PGM_Options const& opt) {
     case PGM_tap_changing_strategy_any_valid_tap:
     case PGM_tap_changing_strategy_max_voltage_tap:
     case PGM_tap_changing_strategy_min_voltage_tap:
+    case PGM_tap_changing_strategy_fast_any_tap:
         return automatic_tap_adjustment;
     default:
         throw MissingCaseForEnumError{"get_optimizer_type", opt.tap_changing_strategy};
@@ -103,6 +146,8 @@ constexpr auto get_optimizer_strategy(PGM_Options const& opt) {
         return global_maximum;
     case PGM_tap_changing_strategy_min_voltage_tap:
         return global_minimum;
+    case PGM_tap_changing_strategy_fast_any_tap:
+        return fast_any;
     default:
         throw MissingCaseForEnumError{"get_optimizer_strategy", opt.tap_changing_strategy};
     }
@@ -116,6 +161,7 @@ constexpr auto extract_calculation_options(PGM_Options const& opt) {
     return MainModel::Options{.calculation_method = get_calculation_method(opt),
                               .optimizer_type = get_optimizer_type(opt),
                               .optimizer_strategy = get_optimizer_strategy(opt),
+                              .optimizer_warm_start = opt.tap_changing_warm_start != 0,
                               .err_tol = opt.err_tol,
                               .max_iter = opt.max_iter,
                               .threading = opt.threading,
@@ -123,6 +169,50 @@ constexpr auto extract_calculation_options(PGM_Options const& opt) {
 }
 } // namespace
 
+namespace {
+template <typename OutputType, typename UpdateType>
+BatchParameter calculate_impl(PGM_PowerGridModel& model, PGM_Options const& opt, OutputType& output,
+                              UpdateType const& update) {
+    check_calculate_valid_options(opt);
+
+    auto const options = extract_calculation_options(opt);
+
+    switch (opt.calculation_type) {
+    case PGM_power_flow:
+        if (opt.symmetric != 0) {
+            return model.calculate_power_flow<symmetric_t>(options, output, update);
+        }
+        return model.calculate_power_flow<asymmetric_t>(options, output, update);
+    case PGM_state_estimation:
+        if (opt.symmetric != 0) {
+            return model.calculate_state_estimation<symmetric_t>(options, output, update);
+        }
+        return model.calculate_state_estimation<asymmetric_t>(options, output, update);
+    case PGM_short_circuit:
+        return model.calculate_short_circuit(options, output, update);
+    default:
+        throw MissingCaseForEnumError{"CalculationType", opt.calculation_type};
+    }
+}
+
+template <typename Functor> void call_calculation_with_catch(PGM_Handle* handle, Functor func) {
+    try {
+        handle->batch_parameter = func();
+    } catch (BatchCalculationError& e) {
+        handle->err_code = PGM_batch_error;
+        handle->err_msg = e.what();
+        handle->failed_scenarios = e.failed_scenarios();
+        handle->batch_errs = e.err_msgs();
+    } catch (std::exception& e) {
+        handle->err_code = PGM_regular_error;
+        handle->err_msg = e.what();
+    } catch (...) {
+        handle->err_code = PGM_regular_error;
+        handle->err_msg = "Unknown error!\n";
+    }
+}
+} // namespace
+
 // run calculation
 void PGM_calculate(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_Options const* opt,
                    PGM_MutableDataset const* output_dataset, PGM_ConstDataset const* batch_dataset) {
@@ -138,50 +228,302 @@ void PGM_calculate(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_Options co
         batch_dataset != nullptr ? *batch_dataset : PGM_ConstDataset{false, 1, "update", output_dataset->meta_data()};
 
     // call calculation
-    try {
-        check_calculate_valid_options(*opt);
+    call_calculation_with_catch(handle, [model, opt, output_dataset, &exported_update_dataset] {
+        return calculate_impl(*model, *opt, *output_dataset, exported_update_dataset);
+    });
+}
+
+// run contingency calculation
+void PGM_calculate_contingency(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_Options const* opt,
+                               PGM_MutableDataset const* output_dataset, PGM_Idx n_outages, PGM_ID const* outage_ids) {
+    PGM_clear_error(handle);
+    // check dataset integrity
+    if (!output_dataset->is_batch() || (n_outages > 0 && outage_ids == nullptr)) {
+        handle->err_code = PGM_regular_error;
+        handle->err_msg = "The output_dataset of a contingency calculation should be a batch with the outage ids!\n";
+        return;
+    }
 
+    call_calculation_with_catch(handle, [model, opt, output_dataset, n_outages, outage_ids] {
+        check_calculate_valid_options(*opt);
+        if (opt->calculation_type != PGM_power_flow) {
+            throw InvalidArguments{
+                "PGM_calculate_contingency",
+                InvalidArguments::TypeValuePair{.name = "CalculationType",
+                                                .value = std::to_string(opt->calculation_type)}};
+        }
         auto const options = extract_calculation_options(*opt);
+        std::span<ID const> const outages{outage_ids, static_cast<size_t>(n_outages)};
+        if (opt->symmetric != 0) {
+            return model->calculate_power_flow<symmetric_t>(options, *output_dataset, outages);
+        }
+        return model->calculate_power_flow<asymmetric_t>(options, *output_dataset, outages);
+    });
+}
 
-        switch (opt->calculation_type) {
-        case PGM_power_flow:
-            if (opt->symmetric != 0) {
-                handle->batch_parameter =
-                    model->calculate_power_flow<symmetric_t>(options, *output_dataset, exported_update_dataset);
-            } else {
-                handle->batch_parameter =
-                    model->calculate_power_flow<asymmetric_t>(options, *output_dataset, exported_update_dataset);
-            }
-            break;
-        case PGM_state_estimation:
+// check observability
+void PGM_check_observability(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_Options const* opt,
+                             PGM_ConstDataset const* batch_dataset) {
+    PGM_clear_error(handle);
+    // check dataset integrity
+    if ((batch_dataset != nullptr) && !batch_dataset->is_batch()) {
+        handle->err_code = PGM_regular_error;
+        handle->err_msg = "If batch_dataset is provided, it should be a batch!\n";
+        return;
+    }
+
+    call_calculation_with_catch(handle, [model, opt, batch_dataset] {
+        auto const options = extract_calculation_options(*opt);
+        if (batch_dataset == nullptr) {
             if (opt->symmetric != 0) {
-                handle->batch_parameter =
-                    model->calculate_state_estimation<symmetric_t>(options, *output_dataset, exported_update_dataset);
+                model->check_observability<symmetric_t>(options);
             } else {
-                handle->batch_parameter =
-                    model->calculate_state_estimation<asymmetric_t>(options, *output_dataset, exported_update_dataset);
+                model->check_observability<asymmetric_t>(options);
             }
-            break;
-        case PGM_short_circuit: {
-            handle->batch_parameter = model->calculate_short_circuit(options, *output_dataset, exported_update_dataset);
-            break;
+            return BatchParameter{};
         }
-        default:
-            throw MissingCaseForEnumError{"CalculationType", opt->calculation_type};
+        if (opt->symmetric != 0) {
+            return model->check_observability<symmetric_t>(options, *batch_dataset);
         }
-    } catch (BatchCalculationError& e) {
-        handle->err_code = PGM_batch_error;
-        handle->err_msg = e.what();
-        handle->failed_scenarios = e.failed_scenarios();
-        handle->batch_errs = e.err_msgs();
-    } catch (std::exception& e) {
+        return model->check_observability<asymmetric_t>(options, *batch_dataset);
+    });
+}
+
+namespace {
+// check the output of a streaming calculation, return an error message if it cannot be used
+char const* check_streaming_output(PGM_Idx n_output_chunks, PGM_MutableDataset const** output_chunks,
+                                   PGM_BatchChunkCallback callback) {
+    if (n_output_chunks < 1 || output_chunks == nullptr ||
+        std::any_of(output_chunks, output_chunks + n_output_chunks,
+                    [](PGM_MutableDataset const* chunk) { return chunk == nullptr; })) {
+        return "A streaming calculation requires at least one output chunk!\n";
+    }
+    if (callback == nullptr) {
+        return "A streaming calculation requires a chunk callback!\n";
+    }
+    return nullptr;
+}
+
+template <typename UpdateSource>
+void calculate_streaming_impl(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_Options const* opt,
+                              PGM_Idx n_output_chunks, PGM_MutableDataset const** output_chunks,
+                              UpdateSource const& update_source, PGM_BatchChunkCallback callback, void* user_data) {
+    call_calculation_with_catch(handle, [model, opt, n_output_chunks, output_chunks, &update_source, callback,
+                                         user_data] {
+        std::vector<MutableDataset> result_chunks;
+        result_chunks.reserve(n_output_chunks);
+        std::transform(output_chunks, output_chunks + n_output_chunks, std::back_inserter(result_chunks),
+                       [](PGM_MutableDataset const* chunk) { return *chunk; });
+
+        MainModel::BatchStream const batch_stream{
+            .result_chunks = result_chunks,
+            .consume_chunk = [callback, user_data, output_chunks, &result_chunks](
+                                 Idx chunk_start, Idx chunk_size, MutableDataset const& result_chunk) {
+                // hand over the dataset as provided by the user
+                callback(user_data, chunk_start, chunk_size,
+                         output_chunks[&result_chunk - result_chunks.data()]);
+            }};
+        return calculate_impl(*model, *opt, batch_stream, update_source);
+    });
+}
+} // namespace
+
+// run streaming batch calculation
+void PGM_calculate_streaming(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_Options const* opt,
+                             PGM_Idx n_output_chunks, PGM_MutableDataset const** output_chunks,
+                             PGM_ConstDataset const* batch_dataset, PGM_BatchChunkCallback callback,
+                             void* user_data) {
+    PGM_clear_error(handle);
+    // check dataset integrity
+    if (auto const* const error = check_streaming_output(n_output_chunks, output_chunks, callback);
+        error != nullptr) {
         handle->err_code = PGM_regular_error;
-        handle->err_msg = e.what();
-    } catch (...) {
+        handle->err_msg = error;
+        return;
+    }
+    if ((batch_dataset != nullptr) && !batch_dataset->is_batch()) {
         handle->err_code = PGM_regular_error;
-        handle->err_msg = "Unknown error!\n";
+        handle->err_msg = "If batch_dataset is provided, it should be a batch!\n";
+        return;
     }
+
+    // without batch dataset, the one-time calculation is handed over as a chunk of one scenario
+    ConstDataset const& exported_update_dataset =
+        batch_dataset != nullptr ? *batch_dataset
+                                 : PGM_ConstDataset{true, 1, "update", output_chunks[0]->meta_data()};
+
+    calculate_streaming_impl(handle, model, opt, n_output_chunks, output_chunks, exported_update_dataset, callback,
+                             user_data);
 }
 
+// run streaming batch calculation with streamed update data
+void PGM_calculate_streaming_updates(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_Options const* opt,
+                                     PGM_Idx n_output_chunks, PGM_MutableDataset const** output_chunks,
+                                     PGM_Idx n_scenarios, PGM_UpdateChunkCallback update_callback,
+                                     void* update_user_data, PGM_BatchChunkCallback callback, void* user_data) {
+    PGM_clear_error(handle);
+    if (auto const* const error = check_streaming_output(n_output_chunks, output_chunks, callback);
+        error != nullptr) {
+        handle->err_code = PGM_regular_error;
+        handle->err_msg = error;
+        return;
+    }
+    if (n_scenarios < 0 || update_callback == nullptr) {
+        handle->err_code = PGM_regular_error;
+        handle->err_msg = "A streaming calculation with streamed updates requires a non-negative number of "
+                          "scenarios and an update callback!\n";
+        return;
+    }
+
+    MainModel::UpdateStream const update_stream{
+        .n_scenarios = n_scenarios,
+        .get_chunk = [update_callback, update_user_data](Idx chunk_start, Idx chunk_size) -> ConstDataset {
+            PGM_ConstDataset const* const chunk_update = update_callback(update_user_data, chunk_start, chunk_size);
+            if (chunk_update == nullptr || !chunk_update->is_batch()) {
+                throw DatasetError{"The update callback should provide a batch dataset for each chunk!\n"};
+            }
+            return *chunk_update;
+        }};
+    calculate_streaming_impl(handle, model, opt, n_output_chunks, output_chunks, update_stream, callback,
+                             user_data);
+}
+
+// create batch reduction
+PGM_BatchReduction* PGM_create_batch_reduction(PGM_Handle* handle) {
+    return call_with_catch(handle, [] { return new PGM_BatchReduction{}; }, PGM_regular_error);
+}
+
+// add rule to batch reduction
+void PGM_batch_reduction_add_rule(PGM_Handle* handle, PGM_BatchReduction* reduction, char const* component,
+                                  char const* attribute, PGM_Idx type, double percentile, double lower, double upper,
+                                  PGM_Idx n_bins) {
+    call_with_catch(
+        handle,
+        [reduction, component, attribute, type, percentile, lower, upper, n_bins] {
+            if (type < PGM_reduction_minimum || type > PGM_reduction_percentile) {
+                throw InvalidArguments{"PGM_batch_reduction_add_rule",
+                                       InvalidArguments::TypeValuePair{.name = "PGM_ReductionType",
+                                                                       .value = std::to_string(type)}};
+            }
+            BatchReductionRule rule{.component = component,
+                                    .attribute = attribute,
+                                    .type = static_cast<ReductionType>(type),
+                                    .percentile = percentile,
+                                    .lower = lower,
+                                    .upper = upper,
+                                    .n_bins = n_bins};
+            BatchReduction const validated_rule{{rule}}; // throws if the rule is invalid
+            reduction->rules.push_back(std::move(rule));
+        },
+        PGM_regular_error);
+}
+
+// run batch calculation with reduction
+void PGM_calculate_reduced(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_Options const* opt,
+                           PGM_BatchReduction* reduction, PGM_ConstDataset const* batch_dataset) {
+    PGM_clear_error(handle);
+    // check dataset integrity
+    if (batch_dataset == nullptr || !batch_dataset->is_batch()) {
+        handle->err_code = PGM_regular_error;
+        handle->err_msg = "The batch_dataset of a reduced calculation should be provided and be a batch!\n";
+        return;
+    }
+
+    call_calculation_with_catch(handle, [model, opt, reduction, batch_dataset] {
+        reduction->reduction = BatchReduction{reduction->rules};
+        return calculate_impl(*model, *opt, reduction->reduction, *batch_dataset);
+    });
+}
+
+// get result of batch reduction
+double const* PGM_batch_reduction_result(PGM_Handle* handle, PGM_BatchReduction const* reduction, PGM_Idx rule,
+                                         PGM_Idx* values_per_element, PGM_Idx* size) {
+    return call_with_catch(
+        handle,
+        [reduction, rule, values_per_element, size]() -> double const* {
+            if (!reduction->reduction.has_result() || rule < 0 ||
+                rule >= std::ssize(reduction->reduction.rules())) {
+                throw InvalidArguments{"PGM_batch_reduction_result",
+                                       InvalidArguments::TypeValuePair{.name = "rule", .value = std::to_string(rule)}};
+            }
+            auto const& result = reduction->reduction.result(rule);
+            *values_per_element = reduction->reduction.values_per_element(rule);
+            *size = std::ssize(result);
+            return result.data();
+        },
+        PGM_regular_error);
+}
+
+// destroy batch reduction
+void PGM_destroy_batch_reduction(PGM_BatchReduction* reduction) { delete reduction; }
+
+// create violation screening
+PGM_ViolationScreening* PGM_create_violation_screening(PGM_Handle* handle) {
+    return call_with_catch(handle, [] { return new PGM_ViolationScreening{}; }, PGM_regular_error);
+}
+
+// add rule to violation screening
+void PGM_violation_screening_add_rule(PGM_Handle* handle, PGM_ViolationScreening* screening, char const* component,
+                                      char const* attribute, double lower, double upper) {
+    call_with_catch(
+        handle,
+        [screening, component, attribute, lower, upper] {
+            ViolationRule rule{.component = component, .attribute = attribute, .lower = lower, .upper = upper};
+            ViolationScreening const validated_rule{{rule}}; // throws if the rule is invalid
+            screening->rules.push_back(std::move(rule));
+        },
+        PGM_regular_error);
+}
+
+// run batch calculation with violation screening
+void PGM_calculate_screened(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_Options const* opt,
+                            PGM_ViolationScreening* screening, PGM_ConstDataset const* batch_dataset) {
+    PGM_clear_error(handle);
+    // check dataset integrity
+    if (batch_dataset == nullptr || !batch_dataset->is_batch()) {
+        handle->err_code = PGM_regular_error;
+        handle->err_msg = "The batch_dataset of a screened calculation should be provided and be a batch!\n";
+        return;
+    }
+    call_calculation_with_catch(handle, [model, opt, screening, batch_dataset] {
+        screening->screening = ViolationScreening{screening->rules};
+        return calculate_impl(*model, *opt, screening->screening, *batch_dataset);
+    });
+}
+
+// get number of violations
+PGM_Idx PGM_violation_screening_n_violations(PGM_Handle* handle, PGM_ViolationScreening const* screening) {
+    return call_with_catch(
+        handle, [screening] { return static_cast<Idx>(std::ssize(screening->screening.violations())); },
+        PGM_regular_error);
+}
+
+// copy violations of violation screening
+void PGM_violation_screening_result(PGM_Handle* handle, PGM_ViolationScreening const* screening, PGM_Idx* scenarios,
+                                    PGM_ID* ids, PGM_Idx* rules, PGM_Idx* phases, double* values) {
+    call_with_catch(
+        handle,
+        [screening, scenarios, ids, rules, phases, values] {
+            auto const& violations = screening->screening.violations();
+            auto const copy_field = [&violations]<class T>(T* buffer, auto projection) {
+                if (buffer != nullptr) {
+                    std::ranges::transform(violations, buffer,
+                                           [&projection](Violation const& violation) -> T {
+                                               return static_cast<T>(std::invoke(projection, violation));
+                                           });
+                }
+            };
+            copy_field(scenarios, &Violation::scenario);
+            copy_field(ids, &Violation::id);
+            copy_field(rules, &Violation::rule);
+            copy_field(phases, &Violation::phase);
+            copy_field(values, &Violation::value);
+        },
+        PGM_regular_error);
+}
+
+// destroy violation screening
+void PGM_destroy_violation_screening(PGM_ViolationScreening* screening) { delete screening; }
+
 // destroy model
 void PGM_destroy_model(PGM_PowerGridModel* model) { delete model; }
@@ -25,5 +25,6 @@ struct PGM_Options {
     Idx threading{-1};
     Idx short_circuit_voltage_scaling{PGM_short_circuit_voltage_scaling_maximum};
     Idx tap_changing_strategy{PGM_tap_changing_strategy_disabled};
+    Idx tap_changing_warm_start{0};
     Idx experimental_features{PGM_experimental_features_disabled};
 };
@@ -41,6 +41,7 @@ class Options:
     max_iterations = OptionSetter(pgc.set_max_iter)
     threading = OptionSetter(pgc.set_threading)
     tap_changing_strategy = OptionSetter(pgc.set_tap_changing_strategy)
+    tap_changing_warm_start = OptionSetter(pgc.set_tap_changing_warm_start)
     short_circuit_voltage_scaling = OptionSetter(pgc.set_short_circuit_voltage_scaling)
     experimental_features = OptionSetter(pgc.set_experimental_features)
 
@@ -327,6 +327,10 @@ class PowerGridCore:
     ) -> None:  # type: ignore[empty-body]
         pass  # pragma: no cover
 
+    @make_c_binding
+    def set_tap_changing_warm_start(self, opt: OptionsPtr, warm_start: int) -> None:  # type: ignore[empty-body]
+        pass  # pragma: no cover
+
     @make_c_binding
     def set_short_circuit_voltage_scaling(
         self, opt: OptionsPtr, short_circuit_voltage_scaling: int
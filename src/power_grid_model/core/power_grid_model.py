@@ -306,6 +306,7 @@ class PowerGridModel:
         continue_on_batch_error: bool = False,
         decode_error: bool = True,
         tap_changing_strategy: Union[TapChangingStrategy, str] = TapChangingStrategy.disabled,
+        tap_changing_warm_start: bool = False,
         experimental_features: Union[_ExperimentalFeatures, str] = _ExperimentalFeatures.disabled,
     ):
         calculation_type = CalculationType.power_flow
@@ -316,6 +317,7 @@ class PowerGridModel:
             max_iterations=max_iterations,
             calculation_method=calculation_method,
             tap_changing_strategy=tap_changing_strategy,
+            tap_changing_warm_start=int(tap_changing_warm_start),
             threading=threading,
             experimental_features=experimental_features,
         )
@@ -414,6 +416,7 @@ class PowerGridModel:
         continue_on_batch_error: bool = False,
         decode_error: bool = True,
         tap_changing_strategy: Union[TapChangingStrategy, str] = TapChangingStrategy.disabled,
+        tap_changing_warm_start: bool = False,
     ) -> Dict[ComponentType, np.ndarray]:
         """
         Calculate power flow once with the current model attributes.
@@ -461,6 +464,10 @@ class PowerGridModel:
                 scenarios fail.
             decode_error (bool, optional):
                 Decode error messages to their derived types if possible.
+            tap_changing_warm_start (bool, optional): Start the automatic tap changing from the optimized tap
+                positions of the previous calculation, i.e. the previous scenario calculated by the same thread in a
+                batch calculation. Applicable only for the any_valid_tap and fast_any_tap strategies.
+                The input tap positions of the model are not changed.
 
         Returns:
             Dictionary of results of all components.
@@ -488,6 +495,7 @@ class PowerGridModel:
             continue_on_batch_error=continue_on_batch_error,
             decode_error=decode_error,
             tap_changing_strategy=tap_changing_strategy,
+            tap_changing_warm_start=tap_changing_warm_start,
         )
 
     def calculate_state_estimation(
@@ -24,5 +24,8 @@ using SerializerPtr = std::unique_ptr<PGM_Serializer, DeleterFunctor<&PGM_destro
 using DeserializerPtr = std::unique_ptr<PGM_Deserializer, DeleterFunctor<&PGM_destroy_deserializer>>;
 using ConstDatasetPtr = std::unique_ptr<PGM_ConstDataset, DeleterFunctor<&PGM_destroy_dataset_const>>;
 using MutableDatasetPtr = std::unique_ptr<PGM_MutableDataset, DeleterFunctor<&PGM_destroy_dataset_mutable>>;
+using BatchReductionPtr = std::unique_ptr<PGM_BatchReduction, DeleterFunctor<&PGM_destroy_batch_reduction>>;
+using ViolationScreeningPtr =
+    std::unique_ptr<PGM_ViolationScreening, DeleterFunctor<&PGM_destroy_violation_screening>>;
 
 } // namespace power_grid_model
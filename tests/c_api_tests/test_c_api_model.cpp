@@ -146,6 +146,44 @@ TEST_CASE("C API Model") {
         CHECK(node_result_0.u_angle == doctest::Approx(0.0));
     }
 
+    SUBCASE("Create model with options") {
+        for (Idx const threading : {-1, 0, 2}) {
+            CAPTURE(threading);
+            PGM_set_threading(hl, opt, threading);
+            ModelPtr const threaded_model{PGM_create_model_with_options(hl, opt, 50.0, input_dataset)};
+            CHECK(PGM_error_code(hl) == PGM_no_error);
+            PGM_calculate(hl, threaded_model.get(), opt, single_output_dataset, nullptr);
+            CHECK(PGM_error_code(hl) == PGM_no_error);
+            CHECK(node_result_0.u_pu == doctest::Approx(0.5));
+        }
+    }
+
+    SUBCASE("Add and remove components") {
+        SymLoadGenInput const added_load_input{
+            .id = 3, .node = 0, .status = 1, .type = LoadGenType::const_i, .p_specified = 0.0, .q_specified = 500.0};
+        ConstDatasetPtr const unique_added_dataset{PGM_create_dataset_const(hl, "input", 0, 1)};
+        PGM_ConstDataset* added_dataset = unique_added_dataset.get();
+        PGM_dataset_const_add_buffer(hl, added_dataset, "sym_load", 1, 1, nullptr, &added_load_input);
+        PGM_add_components(hl, model, added_dataset);
+        CHECK(PGM_error_code(hl) == PGM_no_error);
+        std::array<ID, 1> const load_ids{3};
+        std::array<Idx, 1> indexer{};
+        PGM_get_indexer(hl, model, "sym_load", 1, load_ids.data(), indexer.data());
+        CHECK(PGM_error_code(hl) == PGM_no_error);
+        CHECK(indexer[0] == 1);
+
+        // the node is still referenced by the source and the loads
+        std::array<ID, 1> const node_ids{0};
+        PGM_remove_components(hl, model, 1, node_ids.data());
+        CHECK(PGM_error_code(hl) == PGM_regular_error);
+
+        PGM_remove_components(hl, model, 1, load_ids.data());
+        CHECK(PGM_error_code(hl) == PGM_no_error);
+        PGM_calculate(hl, model, opt, single_output_dataset, nullptr);
+        CHECK(PGM_error_code(hl) == PGM_no_error);
+        CHECK(node_result_0.u == doctest::Approx(50.0));
+    }
+
     SUBCASE("Get indexer") {
         std::array<ID, 2> ids{2, 2};
         std::array<Idx, 2> indexer{3, 3};
@@ -183,6 +221,301 @@ TEST_CASE("C API Model") {
         CHECK(u[2] == doctest::Approx(70.0));
     }
 
+    SUBCASE("Reduced batch power flow") {
+        BatchReductionPtr const unique_reduction{PGM_create_batch_reduction(hl)};
+        PGM_BatchReduction* reduction = unique_reduction.get();
+        PGM_batch_reduction_add_rule(hl, reduction, "node", "u_pu", PGM_reduction_maximum, nan, nan, nan, 0);
+        PGM_batch_reduction_add_rule(hl, reduction, "node", "u_pu", PGM_reduction_mean, nan, nan, nan, 0);
+        PGM_batch_reduction_add_rule(hl, reduction, "node", "u_pu", PGM_reduction_percentile, 50.0, 0.0, 1.0, 100);
+        CHECK(PGM_error_code(hl) == PGM_no_error);
+
+        // no result before the calculation
+        Idx values_per_element{};
+        Idx size{};
+        CHECK(PGM_batch_reduction_result(hl, reduction, 0, &values_per_element, &size) == nullptr);
+        CHECK(PGM_error_code(hl) == PGM_regular_error);
+
+        PGM_calculate_reduced(hl, model, opt, reduction, batch_update_dataset);
+        CHECK(PGM_error_code(hl) == PGM_no_error);
+        auto const check_result = [&](Idx rule, double expected) {
+            double const* const result = PGM_batch_reduction_result(hl, reduction, rule, &values_per_element, &size);
+            CHECK(PGM_error_code(hl) == PGM_no_error);
+            REQUIRE(result != nullptr);
+            CHECK(values_per_element == 1);
+            REQUIRE(size == 1);
+            CHECK(result[0] == doctest::Approx(expected).epsilon(0.02));
+        };
+        check_result(0, 0.7);
+        check_result(1, 0.55);
+        check_result(2, 0.4);
+
+        // invalid rules and datasets
+        PGM_batch_reduction_add_rule(hl, reduction, "node", "u_pu", PGM_reduction_percentile, 150.0, 0.0, 1.0, 100);
+        CHECK(PGM_error_code(hl) == PGM_regular_error);
+        PGM_batch_reduction_add_rule(hl, reduction, "node", "u_pu", PGM_reduction_percentile, 50.0, 1.0, 0.0, 100);
+        CHECK(PGM_error_code(hl) == PGM_regular_error);
+        PGM_batch_reduction_add_rule(hl, reduction, "node", "u_pu", -1, nan, nan, nan, 0);
+        CHECK(PGM_error_code(hl) == PGM_regular_error);
+        CHECK(PGM_batch_reduction_result(hl, reduction, 3, &values_per_element, &size) == nullptr);
+        CHECK(PGM_error_code(hl) == PGM_regular_error);
+        PGM_calculate_reduced(hl, model, opt, reduction, nullptr);
+        CHECK(PGM_error_code(hl) == PGM_regular_error);
+    }
+
+    SUBCASE("Screened batch power flow") {
+        ViolationScreeningPtr const unique_screening{PGM_create_violation_screening(hl)};
+        PGM_ViolationScreening* screening = unique_screening.get();
+        PGM_violation_screening_add_rule(hl, screening, "node", "u_pu", 0.5, 1.0);
+        PGM_violation_screening_add_rule(hl, screening, "node", "u_pu", 0.0, 0.6);
+        CHECK(PGM_error_code(hl) == PGM_no_error);
+
+        // no violations before the calculation
+        CHECK(PGM_violation_screening_n_violations(hl, screening) == 0);
+        CHECK(PGM_error_code(hl) == PGM_no_error);
+
+        // the voltage is 0.4 p.u. in scenario 0 and 0.7 p.u. in scenario 1
+        PGM_calculate_screened(hl, model, opt, screening, batch_update_dataset);
+        CHECK(PGM_error_code(hl) == PGM_no_error);
+        REQUIRE(PGM_violation_screening_n_violations(hl, screening) == 2);
+        std::array<Idx, 2> scenarios{};
+        std::array<ID, 2> ids{};
+        std::array<Idx, 2> rules{};
+        std::array<Idx, 2> phases{};
+        std::array<double, 2> values{};
+        PGM_violation_screening_result(hl, screening, scenarios.data(), ids.data(), rules.data(), phases.data(),
+                                       values.data());
+        CHECK(PGM_error_code(hl) == PGM_no_error);
+        CHECK(scenarios == std::array<Idx, 2>{0, 1});
+        CHECK(ids == std::array<ID, 2>{0, 0});
+        CHECK(rules == std::array<Idx, 2>{0, 1});
+        CHECK(phases == std::array<Idx, 2>{0, 0});
+        CHECK(values[0] == doctest::Approx(0.4));
+        CHECK(values[1] == doctest::Approx(0.7));
+
+        // skipped fields
+        values = {};
+        PGM_violation_screening_result(hl, screening, nullptr, nullptr, nullptr, nullptr, values.data());
+        CHECK(PGM_error_code(hl) == PGM_no_error);
+        CHECK(values[1] == doctest::Approx(0.7));
+
+        // invalid rules and datasets
+        PGM_violation_screening_add_rule(hl, screening, "node", "u_pu", 1.0, 0.5);
+        CHECK(PGM_error_code(hl) == PGM_regular_error);
+        PGM_violation_screening_add_rule(hl, screening, "node", "u_pu", nan, 0.5);
+        CHECK(PGM_error_code(hl) == PGM_regular_error);
+        PGM_calculate_screened(hl, model, opt, screening, nullptr);
+        CHECK(PGM_error_code(hl) == PGM_regular_error);
+        PGM_calculate_screened(hl, model, opt, screening, single_update_dataset);
+        CHECK(PGM_error_code(hl) == PGM_regular_error);
+        PGM_violation_screening_add_rule(hl, screening, "node", "energized", 0.0, 1.0);
+        PGM_calculate_screened(hl, model, opt, screening, batch_update_dataset);
+        CHECK(PGM_error_code(hl) == PGM_regular_error);
+    }
+
+    SUBCASE("Contingency power flow") {
+        // two parallel lines from node_0 to node_3 and a single line from node_0 to node_5
+        std::array<NodeInput, 2> const added_node_inputs{NodeInput{.id = 3, .u_rated = 100.0},
+                                                         NodeInput{.id = 5, .u_rated = 100.0}};
+        auto const line_input = [](ID id, ID to_node) {
+            return LineInput{.id = id,
+                             .from_node = 0,
+                             .to_node = to_node,
+                             .from_status = 1,
+                             .to_status = 1,
+                             .r1 = 1.0,
+                             .x1 = 1.0,
+                             .c1 = 0.0,
+                             .tan1 = 0.0,
+                             .r0 = 1.0,
+                             .x0 = 1.0,
+                             .c0 = 0.0,
+                             .tan0 = 0.0,
+                             .i_n = 100.0};
+        };
+        std::array<LineInput, 3> const line_inputs{line_input(4, 3), line_input(6, 3), line_input(7, 5)};
+        ConstDatasetPtr const unique_added_dataset{PGM_create_dataset_const(hl, "input", 0, 1)};
+        PGM_ConstDataset* added_dataset = unique_added_dataset.get();
+        PGM_dataset_const_add_buffer(hl, added_dataset, "node", 2, 2, nullptr, added_node_inputs.data());
+        PGM_dataset_const_add_buffer(hl, added_dataset, "line", 3, 3, nullptr, line_inputs.data());
+        PGM_add_components(hl, model, added_dataset);
+        REQUIRE(PGM_error_code(hl) == PGM_no_error);
+
+        std::array<NodeOutput<symmetric_t>, 6> contingency_node_outputs{};
+        MutableDatasetPtr const unique_contingency_output_dataset{PGM_create_dataset_mutable(hl, "sym_output", 1, 2)};
+        PGM_MutableDataset* contingency_output_dataset = unique_contingency_output_dataset.get();
+        PGM_dataset_mutable_add_buffer(hl, contingency_output_dataset, "node", 3, 6, nullptr,
+                                       contingency_node_outputs.data());
+
+        // the outage of line_4 is solved by compensation, the outage of line_7 islands node_5
+        PGM_set_calculation_method(hl, opt, PGM_linear);
+        std::array<ID, 2> outage_ids{4, 7};
+        PGM_calculate_contingency(hl, model, opt, contingency_output_dataset, 2, outage_ids.data());
+        CHECK(PGM_error_code(hl) == PGM_no_error);
+        CHECK(contingency_node_outputs[0].id == 0);
+        CHECK(contingency_node_outputs[1].id == 3);
+        CHECK(contingency_node_outputs[1].energized == 1);
+        CHECK(contingency_node_outputs[1].u_pu == doctest::Approx(contingency_node_outputs[0].u_pu));
+        CHECK(contingency_node_outputs[2].energized == 1);
+        CHECK(contingency_node_outputs[3].u_pu == doctest::Approx(contingency_node_outputs[0].u_pu));
+        CHECK(contingency_node_outputs[4].energized == 1);
+        CHECK(contingency_node_outputs[5].id == 5);
+        CHECK(contingency_node_outputs[5].energized == 0);
+
+        // the outaged component should be a branch or branch3, with one scenario per outage
+        outage_ids[1] = 2;
+        PGM_calculate_contingency(hl, model, opt, contingency_output_dataset, 2, outage_ids.data());
+        CHECK(PGM_error_code(hl) == PGM_regular_error);
+        PGM_calculate_contingency(hl, model, opt, contingency_output_dataset, 1, outage_ids.data());
+        CHECK(PGM_error_code(hl) == PGM_regular_error);
+        PGM_calculate_contingency(hl, model, opt, single_output_dataset, 1, outage_ids.data());
+        CHECK(PGM_error_code(hl) == PGM_regular_error);
+        PGM_set_calculation_type(hl, opt, PGM_state_estimation);
+        PGM_calculate_contingency(hl, model, opt, contingency_output_dataset, 2, outage_ids.data());
+        CHECK(PGM_error_code(hl) == PGM_regular_error);
+    }
+
+    SUBCASE("Observability check") {
+        // there are no sensors yet
+        PGM_check_observability(hl, model, opt, nullptr);
+        CHECK(PGM_error_code(hl) == PGM_regular_error);
+
+        SymVoltageSensorInput const voltage_sensor_input{
+            .id = 3, .measured_object = 0, .u_sigma = 1.0, .u_measured = 100.0, .u_angle_measured = nan};
+        ConstDatasetPtr const unique_added_dataset{PGM_create_dataset_const(hl, "input", 0, 1)};
+        PGM_ConstDataset* added_dataset = unique_added_dataset.get();
+        PGM_dataset_const_add_buffer(hl, added_dataset, "sym_voltage_sensor", 1, 1, nullptr, &voltage_sensor_input);
+        PGM_add_components(hl, model, added_dataset);
+        REQUIRE(PGM_error_code(hl) == PGM_no_error);
+
+        PGM_check_observability(hl, model, opt, nullptr);
+        CHECK(PGM_error_code(hl) == PGM_no_error);
+
+        // the second scenario disables the voltage sensor
+        std::array<SymVoltageSensorUpdate, 2> const sensor_updates{
+            SymVoltageSensorUpdate{.id = 3, .u_sigma = nan, .u_measured = nan, .u_angle_measured = nan},
+            SymVoltageSensorUpdate{.id = 3,
+                                   .u_sigma = std::numeric_limits<double>::infinity(),
+                                   .u_measured = nan,
+                                   .u_angle_measured = nan}};
+        ConstDatasetPtr const unique_sensor_update_dataset{PGM_create_dataset_const(hl, "update", 1, 2)};
+        PGM_ConstDataset* sensor_update_dataset = unique_sensor_update_dataset.get();
+        PGM_dataset_const_add_buffer(hl, sensor_update_dataset, "sym_voltage_sensor", 1, 2, nullptr,
+                                     sensor_updates.data());
+        PGM_check_observability(hl, model, opt, sensor_update_dataset);
+        CHECK(PGM_error_code(hl) == PGM_batch_error);
+        REQUIRE(PGM_n_failed_scenarios(hl) == 1);
+        CHECK(PGM_failed_scenarios(hl)[0] == 1);
+
+        // the batch dataset should be a batch
+        PGM_check_observability(hl, model, opt, single_update_dataset);
+        CHECK(PGM_error_code(hl) == PGM_regular_error);
+    }
+
+    SUBCASE("Streaming batch power flow") {
+        // one output chunk of one scenario, handed over for each scenario
+        std::array<NodeOutput<symmetric_t>, 1> chunk_node_output{};
+        MutableDatasetPtr const unique_chunk_output_dataset{PGM_create_dataset_mutable(hl, "sym_output", 1, 1)};
+        PGM_MutableDataset* chunk_output_dataset = unique_chunk_output_dataset.get();
+        PGM_dataset_mutable_add_buffer(hl, chunk_output_dataset, "node", 1, 1, nullptr, chunk_node_output.data());
+        std::array<PGM_MutableDataset const*, 1> output_chunks{chunk_output_dataset};
+
+        // the callback runs on another thread, so the results are only collected there and checked afterwards
+        struct StreamedChunk {
+            PGM_MutableDataset const* output_chunk;
+            Idx chunk_start;
+            Idx chunk_size;
+            double u_pu;
+        };
+        struct StreamedResult {
+            std::array<NodeOutput<symmetric_t>, 1> const* chunk_output;
+            std::vector<StreamedChunk> chunks;
+        };
+        StreamedResult streamed{&chunk_node_output, {}};
+        auto const callback = [](void* user_data, PGM_Idx chunk_start, PGM_Idx chunk_size,
+                                 PGM_MutableDataset const* output_chunk) {
+            auto& result = *static_cast<StreamedResult*>(user_data);
+            result.chunks.push_back({output_chunk, chunk_start, chunk_size, (*result.chunk_output)[0].u_pu});
+        };
+        auto const check_streamed = [&streamed, chunk_output_dataset](std::vector<double> const& expected_u_pu) {
+            REQUIRE(streamed.chunks.size() == expected_u_pu.size());
+            for (Idx chunk = 0; chunk != std::ssize(expected_u_pu); ++chunk) {
+                CAPTURE(chunk);
+                CHECK(streamed.chunks[chunk].output_chunk == chunk_output_dataset);
+                CHECK(streamed.chunks[chunk].chunk_start == chunk);
+                CHECK(streamed.chunks[chunk].chunk_size == 1);
+                CHECK(streamed.chunks[chunk].u_pu == doctest::Approx(expected_u_pu[chunk]));
+            }
+        };
+
+        SUBCASE("Batch update dataset") {
+            PGM_calculate_streaming(hl, model, opt, 1, output_chunks.data(), batch_update_dataset, callback,
+                                    &streamed);
+            CHECK(PGM_error_code(hl) == PGM_no_error);
+            check_streamed({0.4, 0.7});
+        }
+
+        SUBCASE("Single calculation") {
+            PGM_calculate_streaming(hl, model, opt, 1, output_chunks.data(), nullptr, callback, &streamed);
+            CHECK(PGM_error_code(hl) == PGM_no_error);
+            check_streamed({0.5});
+        }
+
+        SUBCASE("Streamed update data") {
+            ConstDatasetPtr const unique_first_chunk_update{PGM_create_dataset_const(hl, "update", 1, 1)};
+            PGM_dataset_const_add_buffer(hl, unique_first_chunk_update.get(), "source", 1, 1, nullptr,
+                                         &source_update);
+            PGM_dataset_const_add_buffer(hl, unique_first_chunk_update.get(), "sym_load", 1, 1, nullptr,
+                                         load_updates.data());
+            ConstDatasetPtr const unique_second_chunk_update{PGM_create_dataset_const(hl, "update", 1, 1)};
+            PGM_dataset_const_add_buffer(hl, unique_second_chunk_update.get(), "sym_load", 1, 1, nullptr,
+                                         &load_updates[1]);
+
+            struct UpdateChunks {
+                std::array<PGM_ConstDataset const*, 2> datasets;
+                std::vector<std::pair<Idx, Idx>> requested;
+            };
+            UpdateChunks update_chunks{{unique_first_chunk_update.get(), unique_second_chunk_update.get()}, {}};
+            auto const update_callback = [](void* user_data, PGM_Idx chunk_start,
+                                            PGM_Idx chunk_size) -> PGM_ConstDataset const* {
+                auto& chunks = *static_cast<UpdateChunks*>(user_data);
+                chunks.requested.emplace_back(chunk_start, chunk_size);
+                return chunks.datasets[chunk_start];
+            };
+
+            PGM_calculate_streaming_updates(hl, model, opt, 1, output_chunks.data(), 2, update_callback,
+                                            &update_chunks, callback, &streamed);
+            CHECK(PGM_error_code(hl) == PGM_no_error);
+            CHECK(update_chunks.requested == std::vector<std::pair<Idx, Idx>>{{0, 1}, {1, 1}});
+            check_streamed({0.4, 0.7});
+
+            // no update data for a chunk
+            auto const missing_update_callback = [](void* /* user_data */, PGM_Idx /* chunk_start */,
+                                                    PGM_Idx /* chunk_size */) -> PGM_ConstDataset const* {
+                return nullptr;
+            };
+            PGM_calculate_streaming_updates(hl, model, opt, 1, output_chunks.data(), 2, missing_update_callback,
+                                            nullptr, callback, &streamed);
+            CHECK(PGM_error_code(hl) == PGM_regular_error);
+        }
+
+        SUBCASE("Invalid arguments") {
+            // single dataset is not allowed
+            PGM_calculate_streaming(hl, model, opt, 1, output_chunks.data(), single_update_dataset, callback,
+                                    &streamed);
+            CHECK(PGM_error_code(hl) == PGM_regular_error);
+            // no output chunks
+            PGM_calculate_streaming(hl, model, opt, 0, nullptr, batch_update_dataset, callback, &streamed);
+            CHECK(PGM_error_code(hl) == PGM_regular_error);
+            // no chunk callback
+            PGM_calculate_streaming(hl, model, opt, 1, output_chunks.data(), batch_update_dataset, nullptr, nullptr);
+            CHECK(PGM_error_code(hl) == PGM_regular_error);
+            PGM_calculate_streaming_updates(hl, model, opt, 1, output_chunks.data(), 0, nullptr, nullptr, nullptr,
+                                            nullptr);
+            CHECK(PGM_error_code(hl) == PGM_regular_error);
+            CHECK(streamed.chunks.empty());
+        }
+    }
+
     SUBCASE("Input error handling") {
         using namespace std::string_literals;
 
@@ -222,6 +555,12 @@ TEST_CASE("C API Model") {
             CHECK_NOTHROW(PGM_calculate(hl, model, opt, single_output_dataset, nullptr));
         }
 
+        SUBCASE("Tap changing strategy with warm start") {
+            PGM_set_tap_changing_strategy(hl, opt, PGM_tap_changing_strategy_fast_any_tap);
+            PGM_set_tap_changing_warm_start(hl, opt, 1);
+            CHECK_NOTHROW(PGM_calculate(hl, model, opt, single_output_dataset, nullptr));
+        }
+
         if (expected_error.empty()) {
             CHECK(PGM_error_code(hl) == PGM_no_error);
         } else {
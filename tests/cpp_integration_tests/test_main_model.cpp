@@ -1224,6 +1224,572 @@ TEST_CASE("Test main model - runtime dispatch") {
     }
 }
 
+TEST_CASE("Test main model - streaming batch") {
+    using CalculationMethod::newton_raphson;
+
+    State state;
+    auto model = default_model(state);
+    std::vector<SymLoadGenUpdate> sym_load_update{
+        {7, 1, nan, 1.0e7}, {7, 1, 1.0e3, nan}, {7, 1, 1.0e3, 1.0e7}, {7, 1, 0.5e6, 0.0}, {7, 0, nan, nan}};
+    auto const n_scenarios = static_cast<Idx>(sym_load_update.size());
+    auto const n_node = static_cast<Idx>(state.sym_node.size());
+    ConstDataset update_data{true, n_scenarios, "update", meta_data::meta_data_gen::meta_data};
+    update_data.add_buffer("sym_load", 1, n_scenarios, nullptr, sym_load_update.data());
+
+    // reference result of a regular batch calculation
+    std::vector<NodeOutput<symmetric_t>> reference_node(n_scenarios * n_node);
+    MutableDataset reference_data{true, n_scenarios, "sym_output", meta_data::meta_data_gen::meta_data};
+    reference_data.add_buffer("node", n_node, std::ssize(reference_node), nullptr, reference_node.data());
+    model.calculate_power_flow<symmetric_t>(get_default_options(newton_raphson), reference_data, update_data);
+
+    // ring of output chunks of two scenarios
+    Idx const chunk_size = 2;
+    auto const make_result_chunks = [chunk_size, n_node](std::vector<std::vector<NodeOutput<symmetric_t>>>& buffers) {
+        std::vector<MutableDataset> result_chunks;
+        for (auto& buffer : buffers) {
+            buffer.resize(chunk_size * n_node);
+            result_chunks.emplace_back(true, chunk_size, "sym_output", meta_data::meta_data_gen::meta_data);
+            result_chunks.back().add_buffer("node", n_node, buffer.size(), nullptr, buffer.data());
+        }
+        return result_chunks;
+    };
+
+    std::vector<NodeOutput<symmetric_t>> streamed_node(n_scenarios * n_node);
+    std::vector<Idx> chunk_starts;
+    auto const consume_chunk = [&streamed_node, &chunk_starts, n_node](Idx chunk_start, Idx n_chunk_scenarios,
+                                                                       MutableDataset const& result_chunk) {
+        chunk_starts.push_back(chunk_start);
+        for (Idx scenario = 0; scenario != n_chunk_scenarios; ++scenario) {
+            auto const nodes = result_chunk.get_buffer_span<meta_data::sym_output_getter_s, Node>(scenario);
+            std::ranges::copy(nodes, std::next(streamed_node.begin(), (chunk_start + scenario) * n_node));
+        }
+    };
+    auto const check_streamed_node = [&streamed_node, &reference_node, &chunk_starts] {
+        CHECK(chunk_starts == std::vector<Idx>{0, 2, 4});
+        for (size_t i = 0; i != reference_node.size(); ++i) {
+            CHECK(streamed_node[i].id == reference_node[i].id);
+            CHECK(streamed_node[i].u_pu == doctest::Approx(reference_node[i].u_pu));
+            CHECK(streamed_node[i].u_angle == doctest::Approx(reference_node[i].u_angle));
+        }
+    };
+
+    SUBCASE("Full update dataset") {
+        for (Idx const n_chunks : {1, 2}) {
+            for (Idx const threading : {-1, 0}) {
+                CAPTURE(n_chunks);
+                CAPTURE(threading);
+                chunk_starts.clear();
+                std::vector<std::vector<NodeOutput<symmetric_t>>> buffers(n_chunks);
+                auto const result_chunks = make_result_chunks(buffers);
+
+                model.calculate_power_flow<symmetric_t>(get_default_options(newton_raphson, threading),
+                                                        MainModel::BatchStream{result_chunks, consume_chunk},
+                                                        update_data);
+                check_streamed_node();
+            }
+        }
+    }
+
+    SUBCASE("Update stream") {
+        std::vector<std::vector<NodeOutput<symmetric_t>>> buffers(2);
+        auto const result_chunks = make_result_chunks(buffers);
+        std::vector<Idx> requested_chunks;
+
+        MainModel::UpdateStream const update_stream{
+            .n_scenarios = n_scenarios,
+            .get_chunk = [&sym_load_update, &requested_chunks](Idx chunk_start, Idx n_chunk_scenarios) {
+                requested_chunks.push_back(chunk_start);
+                ConstDataset chunk_update{true, n_chunk_scenarios, "update", meta_data::meta_data_gen::meta_data};
+                chunk_update.add_buffer("sym_load", 1, n_chunk_scenarios, nullptr,
+                                        std::next(sym_load_update.data(), chunk_start));
+                return chunk_update;
+            }};
+
+        model.calculate_power_flow<symmetric_t>(get_default_options(newton_raphson),
+                                                MainModel::BatchStream{result_chunks, consume_chunk}, update_stream);
+        CHECK(requested_chunks == std::vector<Idx>{0, 2, 4});
+        check_streamed_node();
+    }
+
+    SUBCASE("Invalid result chunks") {
+        std::vector<MutableDataset> const result_chunks{
+            MutableDataset{true, 2, "sym_output", meta_data::meta_data_gen::meta_data},
+            MutableDataset{true, 3, "sym_output", meta_data::meta_data_gen::meta_data}};
+        CHECK_THROWS_AS(model.calculate_power_flow<symmetric_t>(get_default_options(newton_raphson),
+                                                                MainModel::BatchStream{result_chunks, consume_chunk},
+                                                                update_data),
+                        DatasetError);
+        CHECK_THROWS_AS(
+            model.calculate_power_flow<symmetric_t>(get_default_options(newton_raphson),
+                                                    MainModel::BatchStream{{}, consume_chunk}, update_data),
+            DatasetError);
+    }
+}
+
+TEST_CASE("Test main model - batch sequence idx") {
+    using CalculationMethod::newton_raphson;
+
+    State state;
+    auto model = default_model(state);
+
+    // a dependent batch with a different number of updates per scenario,
+    // an unknown id in scenario 2 and the id of an asym_load in scenario 3
+    std::vector<SymLoadGenUpdate> sym_load_update{{7, 1, 1.0e6, nan},     {7, 1, 0.2e6, nan}, {100, 1, 0.5e6, nan},
+                                                  {8, 1, 0.5e6, nan},     {7, 0, nan, nan},   {7, 1, 0.8e6, 0.1e6}};
+    IdxVector const sym_load_indptr{0, 1, 1, 3, 4, 6};
+    std::vector<ShuntUpdate> shunt_update{{9, 0, nan, nan, nan, nan}, {9, 1, nan, nan, nan, nan}};
+    IdxVector const shunt_indptr{0, 0, 1, 1, 1, 2};
+    Idx const n_scenarios = 5;
+
+    ConstDataset update_data{true, n_scenarios, "update", meta_data::meta_data_gen::meta_data};
+    update_data.add_buffer("sym_load", -1, static_cast<Idx>(sym_load_update.size()), sym_load_indptr.data(),
+                           sym_load_update.data());
+    update_data.add_buffer("shunt", -1, static_cast<Idx>(shunt_update.size()), shunt_indptr.data(),
+                           shunt_update.data());
+    REQUIRE(!MainModel::is_update_independent(update_data));
+
+    SUBCASE("Same as the sequence idx of each scenario") {
+        for (Idx const threading : {-1, 0, 2}) {
+            CAPTURE(threading);
+            auto const batch_sequence = model.get_batch_sequence_idx_map(update_data, 0, n_scenarios, threading);
+            CHECK(batch_sequence.is_resolved == std::vector<IntS>{1, 1, 0, 0, 1});
+
+            // the storage of a previous scenario is reused
+            auto scenario_sequence = model.get_sequence_idx_map(update_data, 4);
+            for (Idx const scenario : {0, 1, 4}) {
+                CAPTURE(scenario);
+                model.get_sequence_idx_map(batch_sequence, update_data, scenario, scenario_sequence);
+                CHECK(scenario_sequence == model.get_sequence_idx_map(update_data, scenario));
+            }
+            CHECK_THROWS_AS(model.get_sequence_idx_map(batch_sequence, update_data, 2, scenario_sequence), IDNotFound);
+            CHECK_THROWS_AS(model.get_sequence_idx_map(batch_sequence, update_data, 3, scenario_sequence), IDWrongType);
+        }
+    }
+
+    SUBCASE("Part of the scenarios") {
+        auto const batch_sequence = model.get_batch_sequence_idx_map(update_data, 3, 2);
+        CHECK(batch_sequence.is_resolved == std::vector<IntS>{0, 1});
+        auto scenario_sequence = model.get_sequence_idx_map(update_data, 0);
+        model.get_sequence_idx_map(batch_sequence, update_data, 4, scenario_sequence);
+        CHECK(scenario_sequence == model.get_sequence_idx_map(update_data, 4));
+    }
+
+    SUBCASE("Batch calculation") {
+        auto const n_node = static_cast<Idx>(state.sym_node.size());
+        for (Idx const threading : {-1, 0}) {
+            CAPTURE(threading);
+            std::vector<NodeOutput<symmetric_t>> batch_node(n_scenarios * n_node);
+            MutableDataset batch_result{true, n_scenarios, "sym_output", meta_data::meta_data_gen::meta_data};
+            batch_result.add_buffer("node", n_node, batch_node.size(), nullptr, batch_node.data());
+            try {
+                model.calculate_power_flow<symmetric_t>(get_default_options(newton_raphson, threading), batch_result,
+                                                        update_data);
+                FAIL("the unresolved scenarios should fail");
+            } catch (BatchCalculationError const& e) {
+                CHECK(e.failed_scenarios() == IdxVector{2, 3});
+            }
+
+            // the resolved scenarios are the same as a calculation with the update of that scenario only
+            for (Idx const scenario : {0, 1, 4}) {
+                CAPTURE(scenario);
+                auto scenario_model = model;
+                scenario_model.update_component<MainModel::permanent_update_t>(
+                    update_data, scenario, model.get_sequence_idx_map(update_data, scenario));
+                std::vector<NodeOutput<symmetric_t>> node(n_node);
+                MutableDataset result{false, 1, "sym_output", meta_data::meta_data_gen::meta_data};
+                result.add_buffer("node", n_node, n_node, nullptr, node.data());
+                scenario_model.calculate_power_flow<symmetric_t>(get_default_options(newton_raphson), result);
+                for (Idx i = 0; i != n_node; ++i) {
+                    CHECK(batch_node[scenario * n_node + i].u_pu == doctest::Approx(node[i].u_pu));
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Test main model - batch reduction") {
+    using CalculationMethod::newton_raphson;
+
+    State state;
+    auto model = default_model(state);
+
+    std::vector<SymLoadGenUpdate> sym_load_update{
+        {7, 1, nan, 1.0e7}, {7, 1, 1.0e3, nan}, {7, 1, 1.0e3, 1.0e7}, {7, 1, 0.5e6, 0.0}, {7, 0, nan, nan}};
+    auto const n_scenarios = static_cast<Idx>(sym_load_update.size());
+    auto const n_node = static_cast<Idx>(state.sym_node.size());
+    ConstDataset update_data{true, n_scenarios, "update", meta_data::meta_data_gen::meta_data};
+    update_data.add_buffer("sym_load", 1, n_scenarios, nullptr, sym_load_update.data());
+
+    // reference result of a regular batch calculation
+    std::vector<NodeOutput<symmetric_t>> reference_node(n_scenarios * n_node);
+    MutableDataset reference_data{true, n_scenarios, "sym_output", meta_data::meta_data_gen::meta_data};
+    reference_data.add_buffer("node", n_node, std::ssize(reference_node), nullptr, reference_node.data());
+    model.calculate_power_flow<symmetric_t>(get_default_options(newton_raphson), reference_data, update_data);
+
+    auto const reference_u_pu = [&reference_node, n_node](Idx node) {
+        std::vector<double> u_pu;
+        for (Idx scenario = 0; scenario != std::ssize(reference_node) / n_node; ++scenario) {
+            u_pu.push_back(reference_node[scenario * n_node + node].u_pu);
+        }
+        return u_pu;
+    };
+
+    SUBCASE("Symmetric") {
+        for (Idx const threading : {-1, 0}) {
+            CAPTURE(threading);
+            BatchReduction reduction{{{.component = "node", .attribute = "u_pu", .type = ReductionType::minimum},
+                                      {.component = "node", .attribute = "u_pu", .type = ReductionType::maximum},
+                                      {.component = "node", .attribute = "u_pu", .type = ReductionType::mean},
+                                      {.component = "node",
+                                       .attribute = "u_pu",
+                                       .type = ReductionType::percentile,
+                                       .percentile = 100.0,
+                                       .lower = 0.5,
+                                       .upper = 1.5,
+                                       .n_bins = 1000},
+                                      {.component = "line", .attribute = "loading", .type = ReductionType::maximum}}};
+            model.calculate_power_flow<symmetric_t>(get_default_options(newton_raphson, threading), reduction,
+                                                    update_data);
+
+            for (Idx node = 0; node != n_node; ++node) {
+                CAPTURE(node);
+                auto const u_pu = reference_u_pu(node);
+                CHECK(reduction.values_per_element(0) == 1);
+                CHECK(reduction.result(0)[node] == doctest::Approx(std::ranges::min(u_pu)));
+                CHECK(reduction.result(1)[node] == doctest::Approx(std::ranges::max(u_pu)));
+                CHECK(reduction.result(2)[node] ==
+                      doctest::Approx(std::reduce(u_pu.cbegin(), u_pu.cend()) / static_cast<double>(n_scenarios)));
+                // approximated by the upper edge of the bin containing the maximum
+                CHECK(reduction.result(3)[node] == doctest::Approx(std::ranges::max(u_pu)).epsilon(2e-3));
+            }
+            REQUIRE(reduction.result(4).size() == 1);
+            CHECK(reduction.result(4)[0] > 0.0);
+        }
+    }
+
+    SUBCASE("Asymmetric") {
+        BatchReduction reduction{{{.component = "node", .attribute = "u_pu", .type = ReductionType::maximum}}};
+        model.calculate_power_flow<asymmetric_t>(get_default_options(newton_raphson), reduction, update_data);
+        CHECK(reduction.values_per_element(0) == 3);
+        REQUIRE(std::ssize(reduction.result(0)) == 3 * n_node);
+        CHECK(reduction.result(0)[0] == doctest::Approx(1.05));
+        CHECK(reduction.result(0)[3 * 2 + 1] == doctest::Approx(std::ranges::max(reference_u_pu(2))));
+    }
+
+    SUBCASE("Out-of-range values") {
+        // all voltages are far above the range of the first rule and below the range of the second rule
+        BatchReduction reduction{{{.component = "node",
+                                   .attribute = "u_pu",
+                                   .type = ReductionType::percentile,
+                                   .percentile = 100.0,
+                                   .lower = 0.0,
+                                   .upper = 1.0e-300,
+                                   .n_bins = 2},
+                                  {.component = "node",
+                                   .attribute = "u_pu",
+                                   .type = ReductionType::percentile,
+                                   .percentile = 100.0,
+                                   .lower = 10.0,
+                                   .upper = 11.0,
+                                   .n_bins = 2}}};
+        model.calculate_power_flow<symmetric_t>(get_default_options(newton_raphson), reduction, update_data);
+        for (Idx node = 0; node != n_node; ++node) {
+            CAPTURE(node);
+            CHECK(reduction.result(0)[node] == 1.0e-300);
+            CHECK(reduction.result(1)[node] == doctest::Approx(10.5));
+        }
+    }
+
+    SUBCASE("Invalid reduction") {
+        CHECK_THROWS_AS(BatchReduction({{.component = "node",
+                                         .attribute = "u_pu",
+                                         .type = ReductionType::percentile,
+                                         .percentile = 95.0,
+                                         .lower = 1.0,
+                                         .upper = 1.0}}),
+                        InvalidArguments);
+        CHECK_THROWS_AS(BatchReduction({{.component = "node",
+                                         .attribute = "u_pu",
+                                         .type = ReductionType::percentile,
+                                         .percentile = 95.0,
+                                         .lower = 0.0,
+                                         .upper = 2.0,
+                                         .n_bins = BatchReductionRule::max_n_bins + 1}}),
+                        InvalidArguments);
+
+        BatchReduction reduction{{{.component = "node", .attribute = "energized", .type = ReductionType::maximum}}};
+        CHECK_THROWS_AS(
+            model.calculate_power_flow<symmetric_t>(get_default_options(newton_raphson), reduction, update_data),
+            InvalidArguments);
+    }
+}
+
+TEST_CASE("Test main model - violation screening") {
+    using CalculationMethod::newton_raphson;
+
+    State state;
+    auto model = default_model(state);
+
+    std::vector<SymLoadGenUpdate> sym_load_update{
+        {7, 1, nan, 1.0e7}, {7, 1, 1.0e3, nan}, {7, 1, 1.0e3, 1.0e7}, {7, 1, 0.5e6, 0.0}, {7, 0, nan, nan}};
+    auto const n_scenarios = static_cast<Idx>(sym_load_update.size());
+    auto const n_node = static_cast<Idx>(state.sym_node.size());
+    ConstDataset update_data{true, n_scenarios, "update", meta_data::meta_data_gen::meta_data};
+    update_data.add_buffer("sym_load", 1, n_scenarios, nullptr, sym_load_update.data());
+
+    // reference result of a regular batch calculation
+    std::vector<NodeOutput<symmetric_t>> reference_node(n_scenarios * n_node);
+    MutableDataset reference_data{true, n_scenarios, "sym_output", meta_data::meta_data_gen::meta_data};
+    reference_data.add_buffer("node", n_node, std::ssize(reference_node), nullptr, reference_node.data());
+    model.calculate_power_flow<symmetric_t>(get_default_options(newton_raphson), reference_data, update_data);
+
+    // band around the median voltage, so that there are violations on both sides
+    std::vector<double> u_pu;
+    std::ranges::transform(reference_node, std::back_inserter(u_pu), &NodeOutput<symmetric_t>::u_pu);
+    std::ranges::sort(u_pu);
+    double const lower = u_pu[u_pu.size() / 4];
+    double const upper = u_pu[u_pu.size() * 3 / 4];
+
+    std::vector<Violation> expected;
+    for (Idx scenario = 0; scenario != n_scenarios; ++scenario) {
+        for (Idx node = 0; node != n_node; ++node) {
+            auto const& output = reference_node[scenario * n_node + node];
+            if (output.u_pu < lower || output.u_pu > upper) {
+                expected.push_back(
+                    {.scenario = scenario, .id = output.id, .rule = 0, .phase = 0, .value = output.u_pu});
+            }
+        }
+    }
+    REQUIRE(!expected.empty());
+
+    SUBCASE("Symmetric") {
+        for (Idx const threading : {-1, 0}) {
+            CAPTURE(threading);
+            ViolationScreening screening{{{.component = "node", .attribute = "u_pu", .lower = lower, .upper = upper},
+                                          {.component = "line", .attribute = "loading", .upper = 1.0e6}}};
+            model.calculate_power_flow<symmetric_t>(get_default_options(newton_raphson, threading), screening,
+                                                    update_data);
+
+            auto const& violations = screening.violations();
+            REQUIRE(violations.size() == expected.size());
+            for (size_t i = 0; i != expected.size(); ++i) {
+                CAPTURE(i);
+                CHECK(violations[i].scenario == expected[i].scenario);
+                CHECK(violations[i].id == expected[i].id);
+                CHECK(violations[i].rule == 0);
+                CHECK(violations[i].phase == 0);
+                CHECK(violations[i].value == doctest::Approx(expected[i].value));
+            }
+        }
+    }
+
+    SUBCASE("Asymmetric") {
+        ViolationScreening screening{{{.component = "node", .attribute = "u_pu", .upper = 1.0}}};
+        model.calculate_power_flow<asymmetric_t>(get_default_options(newton_raphson), screening, update_data);
+        // the source node is at 1.05 p.u. in all phases of all scenarios
+        auto const source_violations = std::ranges::count_if(
+            screening.violations(), [](Violation const& violation) { return violation.id == 1; });
+        CHECK(source_violations == 3 * n_scenarios);
+        CHECK(std::ranges::all_of(screening.violations(),
+                                  [](Violation const& violation) { return violation.value > 1.0; }));
+    }
+
+    SUBCASE("Invalid rule") {
+        CHECK_THROWS_AS(ViolationScreening({{.component = "node", .attribute = "u_pu", .lower = 1.1, .upper = 0.9}}),
+                        InvalidArguments);
+    }
+}
+
+namespace {
+// meshed grid, in which only the outage of line 17 to node 5 changes the island structure
+auto contingency_model() -> MainModel {
+    MainModel main_model{50.0, meta_data::meta_data_gen::meta_data};
+
+    std::vector<NodeInput> const node_input{{1, 10e3}, {2, 10e3}, {3, 10e3}, {4, 10e3}, {5, 10e3}};
+    std::vector<LineInput> const line_input{{11, 1, 2, 1, 1, 0.1, 0.2, 0.0, 0.0, 0.1, 0.2, 0.0, 0.0, 1e3},
+                                            {12, 2, 3, 1, 1, 0.2, 0.4, 0.0, 0.0, 0.2, 0.4, 0.0, 0.0, 1e3},
+                                            {13, 3, 4, 1, 1, 0.1, 0.3, 0.0, 0.0, 0.1, 0.3, 0.0, 0.0, 1e3},
+                                            {14, 4, 1, 1, 1, 0.3, 0.5, 0.0, 0.0, 0.3, 0.5, 0.0, 0.0, 1e3},
+                                            {15, 1, 3, 1, 1, 0.2, 0.2, 0.0, 0.0, 0.2, 0.2, 0.0, 0.0, 1e3},
+                                            {17, 4, 5, 1, 1, 0.1, 0.1, 0.0, 0.0, 0.1, 0.1, 0.0, 0.0, 1e3}};
+    std::vector<ThreeWindingTransformerInput> const transformer3w_input{{.id = 16,
+                                                                         .node_1 = 2,
+                                                                         .node_2 = 3,
+                                                                         .node_3 = 4,
+                                                                         .status_1 = 1,
+                                                                         .status_2 = 1,
+                                                                         .status_3 = 1,
+                                                                         .u1 = 10e3,
+                                                                         .u2 = 10e3,
+                                                                         .u3 = 10e3,
+                                                                         .sn_1 = 1e6,
+                                                                         .sn_2 = 1e6,
+                                                                         .sn_3 = 1e6,
+                                                                         .uk_12 = 0.1,
+                                                                         .uk_13 = 0.1,
+                                                                         .uk_23 = 0.1,
+                                                                         .pk_12 = 1e3,
+                                                                         .pk_13 = 1e3,
+                                                                         .pk_23 = 1e3,
+                                                                         .i0 = 0.0,
+                                                                         .p0 = 0.0,
+                                                                         .winding_1 = WindingType::wye_n,
+                                                                         .winding_2 = WindingType::wye_n,
+                                                                         .winding_3 = WindingType::wye_n,
+                                                                         .clock_12 = 0,
+                                                                         .clock_13 = 0,
+                                                                         .tap_side = Branch3Side::side_1,
+                                                                         .tap_pos = 0,
+                                                                         .tap_min = -1,
+                                                                         .tap_max = 1,
+                                                                         .tap_nom = 0,
+                                                                         .tap_size = 100.0}};
+    std::vector<SourceInput> const source_input{{6, 1, 1, 1.02, nan, 1e10, nan, nan}};
+    std::vector<SymLoadGenInput> const sym_load_input{{7, 3, 1, LoadGenType::const_pq, 1e6, 0.2e6},
+                                                      {8, 4, 1, LoadGenType::const_pq, 0.5e6, 0.1e6},
+                                                      {9, 5, 1, LoadGenType::const_pq, 0.2e6, 0.0}};
+
+    main_model.add_component<Node>(node_input);
+    main_model.add_component<Line>(line_input);
+    main_model.add_component<ThreeWindingTransformer>(transformer3w_input);
+    main_model.add_component<Source>(source_input);
+    main_model.add_component<SymLoad>(sym_load_input);
+    main_model.set_construction_complete();
+
+    return main_model;
+}
+
+template <symmetry_tag sym> void check_contingency(Idx threading) {
+    auto model = contingency_model();
+    std::vector<ID> const outage_ids{11, 12, 13, 14, 15, 16, 17};
+    auto const n_scenarios = static_cast<Idx>(outage_ids.size());
+    constexpr Idx n_node = 5;
+    constexpr Idx n_line = 6;
+    auto const options = get_default_options(CalculationMethod::linear, threading);
+    std::string_view const output_dataset = is_symmetric_v<sym> ? "sym_output" : "asym_output";
+
+    // reference by regular batch calculation with the outages in the update data
+    std::vector<BranchUpdate> line_update{{11, 0, 0}, {12, 0, 0}, {13, 0, 0}, {14, 0, 0}, {15, 0, 0}, {17, 0, 0}};
+    std::vector<Branch3Update> transformer3w_update{{16, 0, 0, 0}};
+    IdxVector line_indptr{0, 1, 2, 3, 4, 5, 5, 6};
+    IdxVector transformer3w_indptr{0, 0, 0, 0, 0, 0, 1, 1};
+    ConstDataset update_data{true, n_scenarios, "update", meta_data::meta_data_gen::meta_data};
+    update_data.add_buffer("line", -1, std::ssize(line_update), line_indptr.data(), line_update.data());
+    update_data.add_buffer("three_winding_transformer", -1, std::ssize(transformer3w_update),
+                           transformer3w_indptr.data(), transformer3w_update.data());
+
+    auto const run = [&](auto&& calculate) {
+        std::vector<NodeOutput<sym>> node(n_scenarios * n_node);
+        std::vector<BranchOutput<sym>> line(n_scenarios * n_line);
+        std::vector<Branch3Output<sym>> transformer3w(n_scenarios);
+        MutableDataset result_data{true, n_scenarios, output_dataset, meta_data::meta_data_gen::meta_data};
+        result_data.add_buffer("node", n_node, std::ssize(node), nullptr, node.data());
+        result_data.add_buffer("line", n_line, std::ssize(line), nullptr, line.data());
+        result_data.add_buffer("three_winding_transformer", 1, n_scenarios, nullptr, transformer3w.data());
+        calculate(result_data);
+        return std::make_tuple(node, line, transformer3w);
+    };
+    auto const [ref_node, ref_line, ref_transformer3w] = run([&](MutableDataset const& result_data) {
+        model.calculate_power_flow<sym>(options, result_data, update_data);
+    });
+    auto const [node, line, transformer3w] = run([&](MutableDataset const& result_data) {
+        model.calculate_power_flow<sym>(options, result_data, std::span<ID const>{outage_ids});
+    });
+    // the outages without islanding are solved by compensation
+    CHECK(model.calculation_info().contains(Timer::make_key(2232, "Solve by compensation")));
+
+    auto const difference = [](RealValue<sym> const& x, RealValue<sym> const& y) {
+        if constexpr (is_symmetric_v<sym>) {
+            return std::abs(x - y);
+        } else {
+            return (x - y).abs().maxCoeff();
+        }
+    };
+    for (Idx i = 0; i != n_scenarios * n_node; ++i) {
+        CAPTURE(i);
+        CHECK(node[i].energized == ref_node[i].energized);
+        CHECK(difference(node[i].u_pu, ref_node[i].u_pu) < 1e-8);
+        CHECK(difference(node[i].p, ref_node[i].p) < 1e-2);
+    }
+    for (Idx i = 0; i != n_scenarios * n_line; ++i) {
+        CAPTURE(i);
+        CHECK(line[i].energized == ref_line[i].energized);
+        CHECK(difference(line[i].i_from, ref_line[i].i_from) < 1e-6);
+        CHECK(difference(line[i].p_to, ref_line[i].p_to) < 1e-2);
+    }
+    for (Idx i = 0; i != n_scenarios; ++i) {
+        CAPTURE(i);
+        CHECK(transformer3w[i].energized == ref_transformer3w[i].energized);
+        CHECK(difference(transformer3w[i].p_1, ref_transformer3w[i].p_1) < 1e-2);
+    }
+    // the outaged components are not energized, the islanded node 5 is not energized after the outage of line 17
+    CHECK(line[0].energized == 0);
+    CHECK(transformer3w[5].energized == 0);
+    CHECK(node[6 * n_node + 4].energized == 0);
+}
+} // namespace
+
+TEST_CASE("Test main model - contingency analysis") {
+    SUBCASE("Symmetric") {
+        check_contingency<symmetric_t>(-1);
+        check_contingency<symmetric_t>(0);
+    }
+    SUBCASE("Asymmetric") { check_contingency<asymmetric_t>(-1); }
+
+    SUBCASE("Invalid outage") {
+        auto model = contingency_model();
+        std::vector<SymNodeOutput> node(5);
+        MutableDataset result_data{true, 1, "sym_output", meta_data::meta_data_gen::meta_data};
+        result_data.add_buffer("node", 5, 5, nullptr, node.data());
+        auto const options = get_default_options(CalculationMethod::linear);
+
+        std::vector<ID> const node_outage{1};
+        CHECK_THROWS_AS(model.calculate_power_flow<symmetric_t>(options, result_data, std::span<ID const>{node_outage}),
+                        IDWrongType);
+        std::vector<ID> const two_outages{11, 12};
+        CHECK_THROWS_AS(model.calculate_power_flow<symmetric_t>(options, result_data, std::span<ID const>{two_outages}),
+                        DatasetError);
+    }
+}
+
+TEST_CASE("Test main model - linear power flow with low-rank update") {
+    auto model = contingency_model();
+    constexpr Idx n_node = 5;
+    auto const options = get_default_options(CalculationMethod::linear);
+
+    // each scenario changes a single load, which changes a single diagonal entry of the matrix
+    std::vector<SymLoadGenUpdate> sym_load_update{{8, 1, 1.0e6, nan}, {8, 1, 0.2e6, nan}, {9, 1, 0.5e6, 0.1e6}};
+    auto const n_scenarios = std::ssize(sym_load_update);
+    ConstDataset update_data{true, n_scenarios, "update", meta_data::meta_data_gen::meta_data};
+    update_data.add_buffer("sym_load", 1, n_scenarios, nullptr, sym_load_update.data());
+
+    std::vector<SymNodeOutput> node(n_scenarios * n_node);
+    MutableDataset result_data{true, n_scenarios, "sym_output", meta_data::meta_data_gen::meta_data};
+    result_data.add_buffer("node", n_node, std::ssize(node), nullptr, node.data());
+    model.calculate_power_flow<symmetric_t>(options, result_data, update_data);
+    CHECK(model.calculation_info().contains(Timer::make_key(2224, "Solve by low-rank update")));
+
+    // reference by a fresh model for each scenario, which factorizes the updated matrix
+    for (Idx scenario = 0; scenario != n_scenarios; ++scenario) {
+        CAPTURE(scenario);
+        auto ref_model = contingency_model();
+        ConstDataset scenario_update{false, 1, "update", meta_data::meta_data_gen::meta_data};
+        scenario_update.add_buffer("sym_load", 1, 1, nullptr, &sym_load_update[scenario]);
+        ref_model.update_component<MainModel::permanent_update_t>(scenario_update);
+
+        std::vector<SymNodeOutput> ref_node(n_node);
+        MutableDataset ref_result{false, 1, "sym_output", meta_data::meta_data_gen::meta_data};
+        ref_result.add_buffer("node", n_node, n_node, nullptr, ref_node.data());
+        ref_model.calculate_power_flow<symmetric_t>(options, ref_result);
+        CHECK_FALSE(ref_model.calculation_info().contains(Timer::make_key(2224, "Solve by low-rank update")));
+
+        for (Idx i = 0; i != n_node; ++i) {
+            CHECK(node[scenario * n_node + i].u_pu == doctest::Approx(ref_node[i].u_pu));
+            CHECK(node[scenario * n_node + i].u_angle == doctest::Approx(ref_node[i].u_angle));
+        }
+    }
+}
+
 namespace {
 auto incomplete_input_model(State const& state) -> MainModel {
     MainModel main_model{50.0, meta_data::meta_data_gen::meta_data};
@@ -1247,6 +1813,327 @@ auto incomplete_input_model(State const& state) -> MainModel {
 }
 } // namespace
 
+TEST_CASE("Test main model - tap changing warm start") {
+    using CalculationMethod::newton_raphson;
+
+    // regulated 10 kV / 400 V transformer, one tap step is about 8 V at the control side
+    MainModel model{50.0, meta_data::meta_data_gen::meta_data};
+    model.add_component<Node>(std::vector<NodeInput>{{1, 10e3}, {2, 400.0}});
+    model.add_component<Source>(std::vector<SourceInput>{{.id = 3,
+                                                          .node = 1,
+                                                          .status = 1,
+                                                          .u_ref = 1.0,
+                                                          .u_ref_angle = 0.0,
+                                                          .sk = 1e20,
+                                                          .rx_ratio = 0.1,
+                                                          .z01_ratio = 1.0}});
+    model.add_component<Transformer>(std::vector<TransformerInput>{{.id = 4,
+                                                                    .from_node = 1,
+                                                                    .to_node = 2,
+                                                                    .from_status = 1,
+                                                                    .to_status = 1,
+                                                                    .u1 = 10e3,
+                                                                    .u2 = 400.0,
+                                                                    .sn = 1e6,
+                                                                    .uk = 0.1,
+                                                                    .pk = 1e3,
+                                                                    .i0 = 0.0,
+                                                                    .p0 = 0.0,
+                                                                    .winding_from = WindingType::wye_n,
+                                                                    .winding_to = WindingType::wye_n,
+                                                                    .clock = 0,
+                                                                    .tap_side = BranchSide::from,
+                                                                    .tap_pos = 0,
+                                                                    .tap_min = -5,
+                                                                    .tap_max = 5,
+                                                                    .tap_nom = 0,
+                                                                    .tap_size = 200.0}});
+    model.add_component<SymLoad>(std::vector<SymLoadGenInput>{
+        {.id = 5, .node = 2, .status = 1, .type = LoadGenType::const_pq, .p_specified = 5e5, .q_specified = 1e5}});
+    model.add_component<TransformerTapRegulator>(
+        std::vector<TransformerTapRegulatorInput>{{.id = 6,
+                                                   .regulated_object = 4,
+                                                   .status = 1,
+                                                   .control_side = ControlSide::side_2,
+                                                   .u_set = 400.0,
+                                                   .u_band = 10.0,
+                                                   .line_drop_compensation_r = 0.0,
+                                                   .line_drop_compensation_x = 0.0}});
+    model.set_construction_complete();
+
+    // the heavy load needs a lower tap position, after which the initial tap position is in band again
+    std::vector<SymLoadGenUpdate> sym_load_update{{5, 1, 1.2e6, 2e5}, {5, 1, 5e5, 1e5}, {5, 1, 5e5, 1e5}};
+    auto const n_scenarios = static_cast<Idx>(sym_load_update.size());
+    ConstDataset update_data{true, n_scenarios, "update", meta_data::meta_data_gen::meta_data};
+    update_data.add_buffer("sym_load", 1, n_scenarios, nullptr, sym_load_update.data());
+
+    auto const base_output = model.calculate_power_flow<symmetric_t>(get_default_options(newton_raphson));
+
+    auto const calculate = [&](bool warm_start, Idx threading) {
+        std::vector<NodeOutput<symmetric_t>> node(n_scenarios * 2);
+        std::vector<TransformerTapRegulatorOutput> regulator(n_scenarios);
+        MutableDataset result_data{true, n_scenarios, "sym_output", meta_data::meta_data_gen::meta_data};
+        result_data.add_buffer("node", 2, node.size(), nullptr, node.data());
+        result_data.add_buffer("transformer_tap_regulator", 1, regulator.size(), nullptr, regulator.data());
+
+        auto options = get_default_options(newton_raphson, threading);
+        options.optimizer_type = OptimizerType::automatic_tap_adjustment;
+        options.optimizer_strategy = OptimizerStrategy::any;
+        options.optimizer_warm_start = warm_start;
+        model.calculate_power_flow<symmetric_t>(options, result_data, update_data);
+
+        for (Idx scenario = 0; scenario != n_scenarios; ++scenario) {
+            CAPTURE(scenario);
+            CHECK(node[scenario * 2 + 1].u == doctest::Approx(400.0).epsilon(0.0126));
+        }
+
+        // the base state is restored
+        auto const output = model.calculate_power_flow<symmetric_t>(get_default_options(newton_raphson));
+        REQUIRE(output.solver_output.size() == base_output.solver_output.size());
+        CHECK(cabs(output.solver_output[0].u[1] - base_output.solver_output[0].u[1]) < 1e-12);
+
+        std::vector<IntS> tap_pos;
+        std::ranges::transform(regulator, std::back_inserter(tap_pos), [](auto const& x) { return x.tap_pos; });
+        return tap_pos;
+    };
+
+    SUBCASE("Cold start") { CHECK(calculate(false, -1) == std::vector<IntS>{-1, 0, 0}); }
+    SUBCASE("Warm start") {
+        // the search starts from the previous optimum, which stays in band
+        CHECK(calculate(true, -1) == std::vector<IntS>{-1, -1, -1});
+    }
+    SUBCASE("Warm start per thread") {
+        // every thread starts from the optimum of the base state, then from its own previous scenario
+        CHECK(calculate(true, 2) == std::vector<IntS>{-1, 0, -1});
+    }
+}
+
+TEST_CASE("Test main model - concurrent construction") {
+    using CalculationMethod::newton_raphson;
+
+    State state;
+    auto const make_input_data = [&state](std::vector<LineInput>& line_input, std::vector<ShuntInput>& shunt_input) {
+        ConstDataset input_data{false, 1, "input", meta_data::meta_data_gen::meta_data};
+        input_data.add_buffer("node", state.node_input.size(), state.node_input.size(), nullptr,
+                              state.node_input.data());
+        input_data.add_buffer("line", line_input.size(), line_input.size(), nullptr, line_input.data());
+        input_data.add_buffer("link", state.link_input.size(), state.link_input.size(), nullptr,
+                              state.link_input.data());
+        input_data.add_buffer("source", state.source_input.size(), state.source_input.size(), nullptr,
+                              state.source_input.data());
+        input_data.add_buffer("sym_load", state.sym_load_input.size(), state.sym_load_input.size(), nullptr,
+                              state.sym_load_input.data());
+        input_data.add_buffer("asym_load", state.asym_load_input.size(), state.asym_load_input.size(), nullptr,
+                              state.asym_load_input.data());
+        input_data.add_buffer("shunt", shunt_input.size(), shunt_input.size(), nullptr, shunt_input.data());
+        input_data.add_buffer("sym_power_sensor", state.sym_power_sensor_input.size(),
+                              state.sym_power_sensor_input.size(), nullptr, state.sym_power_sensor_input.data());
+        input_data.add_buffer("sym_voltage_sensor", state.sym_voltage_sensor_input.size(),
+                              state.sym_voltage_sensor_input.size(), nullptr, state.sym_voltage_sensor_input.data());
+        return input_data;
+    };
+    auto line_input = state.line_input;
+    auto shunt_input = state.shunt_input;
+
+    SUBCASE("Same model as sequential construction") {
+        auto const input_data = make_input_data(line_input, shunt_input);
+        MainModel sequential_model{50.0, input_data, 0, MainModel::Options::sequential};
+        MainModel concurrent_model{50.0, input_data, 0, 4};
+
+        CHECK(concurrent_model.all_component_count() == sequential_model.all_component_count());
+        CHECK(concurrent_model.calculation_info().contains(Timer::make_key(4000, "Construct model")));
+        CHECK(concurrent_model.calculation_info().contains(Timer::make_key(4100, "Add components")));
+
+        auto const n_node = static_cast<Idx>(state.node_input.size());
+        auto const calculate = [n_node](MainModel& model) {
+            std::vector<NodeOutput<symmetric_t>> node(n_node);
+            MutableDataset result_data{false, 1, "sym_output", meta_data::meta_data_gen::meta_data};
+            result_data.add_buffer("node", n_node, n_node, nullptr, node.data());
+            model.calculate_power_flow<symmetric_t>(get_default_options(newton_raphson), result_data);
+            return node;
+        };
+        auto const sequential = calculate(sequential_model);
+        auto const concurrent = calculate(concurrent_model);
+        for (Idx i = 0; i != n_node; ++i) {
+            CAPTURE(i);
+            CHECK(concurrent[i].u_pu == doctest::Approx(sequential[i].u_pu));
+            CHECK(concurrent[i].u_angle == doctest::Approx(sequential[i].u_angle));
+        }
+    }
+
+    SUBCASE("Unknown node") {
+        line_input[0].to_node = 100;
+        auto const input_data = make_input_data(line_input, shunt_input);
+        CHECK_THROWS_AS((MainModel{50.0, input_data, 0, 4}), IDNotFound);
+    }
+
+    SUBCASE("Conflicting id") {
+        // the shunt is added after the line, so the id conflicts with the line
+        shunt_input[0].id = line_input[0].id;
+        auto const input_data = make_input_data(line_input, shunt_input);
+        CHECK_THROWS_AS((MainModel{50.0, input_data, 0, 4}), ConflictID);
+    }
+
+    SUBCASE("Errors in input order") {
+        // the first line conflicts with a node, the second line and the shunt have an unknown node
+        line_input[0].id = state.node_input[0].id;
+        line_input.push_back(state.line_input[0]);
+        line_input[1].to_node = 100;
+        shunt_input[0].node = 100;
+        auto const input_data = make_input_data(line_input, shunt_input);
+        CHECK_THROWS_AS((MainModel{50.0, input_data, 0, MainModel::Options::sequential}), ConflictID);
+        CHECK_THROWS_AS((MainModel{50.0, input_data, 0, 4}), ConflictID);
+    }
+}
+
+TEST_CASE("Test main model - concurrent islands") {
+    using CalculationMethod::newton_raphson;
+
+    State state;
+    auto model = default_model(state);
+
+    // split the grid in two islands, each with its own source
+    std::vector<BranchUpdate> link_update{{5, 0, 0}};
+    std::vector<SourceUpdate> source_update{{10, 1, nan, nan}};
+    ConstDataset update_data{false, 1, "update", meta_data::meta_data_gen::meta_data};
+    update_data.add_buffer("link", 1, 1, nullptr, link_update.data());
+    update_data.add_buffer("source", 1, 1, nullptr, source_update.data());
+    model.update_component<MainModel::permanent_update_t>(update_data);
+
+    auto const n_node = static_cast<Idx>(state.node_input.size());
+    auto const calculate = [&model, n_node](Idx threading) {
+        std::vector<NodeOutput<symmetric_t>> node(n_node);
+        MutableDataset result_data{false, 1, "sym_output", meta_data::meta_data_gen::meta_data};
+        result_data.add_buffer("node", n_node, n_node, nullptr, node.data());
+        model.calculate_power_flow<symmetric_t>(get_default_options(newton_raphson, threading), result_data);
+        return node;
+    };
+
+    auto const sequential = calculate(-1);
+    auto const sequential_info = model.calculation_info();
+    auto const concurrent = calculate(2);
+    auto const& concurrent_info = model.calculation_info();
+
+    for (Idx i = 0; i != n_node; ++i) {
+        CAPTURE(i);
+        CHECK(concurrent[i].energized == 1);
+        CHECK(concurrent[i].u_pu == doctest::Approx(sequential[i].u_pu));
+        CHECK(concurrent[i].u_angle == doctest::Approx(sequential[i].u_angle));
+    }
+    // the timings of the islands are merged in the calculation info of the model
+    auto const math_solver_key = Timer::make_key(2220, "Math solver");
+    CHECK(sequential_info.contains(math_solver_key));
+    CHECK(concurrent_info.contains(math_solver_key));
+}
+
+TEST_CASE("Test main model - structural edits") {
+    using CalculationMethod::newton_raphson;
+
+    State state;
+    auto model = default_model(state);
+    auto expected_model = default_model(state);
+
+    auto const n_node = static_cast<Idx>(state.node_input.size());
+    auto const check_same_result = [n_node](MainModel& actual_model, MainModel& reference_model) {
+        auto const calculate = [](MainModel& calculated_model) {
+            auto const n_calculated_node = calculated_model.component_count<Node>();
+            std::vector<NodeOutput<symmetric_t>> node(n_calculated_node);
+            MutableDataset result_data{false, 1, "sym_output", meta_data::meta_data_gen::meta_data};
+            result_data.add_buffer("node", n_calculated_node, n_calculated_node, nullptr, node.data());
+            calculated_model.calculate_power_flow<symmetric_t>(get_default_options(newton_raphson), result_data);
+            return node;
+        };
+        auto const actual = calculate(actual_model);
+        auto const expected = calculate(reference_model);
+        for (Idx i = 0; i != n_node; ++i) {
+            CAPTURE(i);
+            CHECK(actual[i].u_pu == doctest::Approx(expected[i].u_pu));
+            CHECK(actual[i].u_angle == doctest::Approx(expected[i].u_angle));
+        }
+    };
+    auto const update_load = [](MainModel& updated_model, SymLoadGenUpdate load_update) {
+        ConstDataset update_data{false, 1, "update", meta_data::meta_data_gen::meta_data};
+        update_data.add_buffer("sym_load", 1, 1, nullptr, &load_update);
+        updated_model.update_component<MainModel::permanent_update_t>(update_data);
+    };
+    auto const n_sym_power_sensor = static_cast<Idx>(state.sym_power_sensor_input.size());
+    auto const create_solver_key = Timer::make_key(2210, "Create math solver");
+
+    // calculate before the edits, so that the edits also have to invalidate the solvers
+    check_same_result(model, expected_model);
+
+    SUBCASE("Add components") {
+        std::vector<SymLoadGenInput> sym_load_input{{50, 3, 1, LoadGenType::const_y, 0.5e6, 0.0}};
+        std::vector<SymPowerSensorInput> sym_power_sensor_input{
+            {51, 50, MeasuredTerminalType::load, 0.02, 0.5e6, 0.0, nan, nan}};
+        ConstDataset input_data{false, 1, "input", meta_data::meta_data_gen::meta_data};
+        input_data.add_buffer("sym_load", 1, 1, nullptr, sym_load_input.data());
+        input_data.add_buffer("sym_power_sensor", 1, 1, nullptr, sym_power_sensor_input.data());
+        model.add_components(input_data);
+        CHECK(model.component_count<SymLoad>() == 2);
+        CHECK(model.component_count<SymPowerSensor>() == n_sym_power_sensor + 1);
+
+        // the same as doubling the existing constant admittance load
+        update_load(expected_model, {7, 1, 1.0e6, nan});
+        check_same_result(model, expected_model);
+    }
+
+    SUBCASE("Add an isolated node") {
+        std::vector<NodeInput> node_input{{60, 10e3}};
+        ConstDataset input_data{false, 1, "input", meta_data::meta_data_gen::meta_data};
+        input_data.add_buffer("node", 1, 1, nullptr, node_input.data());
+        model.add_components(input_data);
+        CHECK(model.component_count<Node>() == n_node + 1);
+
+        // the island of the source is not affected, so its solver is kept
+        check_same_result(model, expected_model);
+        CHECK_FALSE(model.calculation_info().contains(create_solver_key));
+    }
+
+    SUBCASE("Remove components") {
+        std::vector<ID> const ids{7, 16, 23};
+        model.remove_components(ids);
+        CHECK(model.component_count<SymLoad>() == 0);
+        CHECK(model.component_count<SymPowerSensor>() == n_sym_power_sensor - 1);
+        std::vector<ID> const sensor_ids{17, 28};
+        IdxVector indexer(2);
+        model.get_indexer("sym_power_sensor", sensor_ids.data(), 2, indexer.data());
+        CHECK(indexer == IdxVector{4, 5});
+
+        // the same as disconnecting the load
+        update_load(expected_model, {7, 0, nan, nan});
+        check_same_result(model, expected_model);
+    }
+
+    SUBCASE("Invalid removal") {
+        std::vector<ID> const referenced_ids{7};
+        CHECK_THROWS_AS(model.remove_components(referenced_ids), ReferencedComponentRemoval);
+        std::vector<ID> const unknown_ids{7, 16, 23, 100};
+        CHECK_THROWS_AS(model.remove_components(unknown_ids), IDNotFound);
+
+        CHECK(model.component_count<SymLoad>() == 1);
+        CHECK(model.component_count<SymPowerSensor>() == n_sym_power_sensor);
+        check_same_result(model, expected_model);
+    }
+
+    SUBCASE("Invalid addition") {
+        std::vector<SymLoadGenInput> sym_load_input{{50, 3, 1, LoadGenType::const_y, 0.5e6, 0.0},
+                                                    {51, 3, 1, LoadGenType::const_y, 0.5e6, 0.0}};
+        ConstDataset input_data{false, 1, "input", meta_data::meta_data_gen::meta_data};
+        input_data.add_buffer("sym_load", 2, 2, nullptr, sym_load_input.data());
+
+        SUBCASE("Unknown node") { sym_load_input[1].node = 100; }
+        SUBCASE("Conflicting id") { sym_load_input[1].id = 9; }
+
+        CHECK_THROWS_AS(model.add_components(input_data), PowerGridError);
+        CHECK(model.component_count<SymLoad>() == 1);
+        CHECK(model.all_component_count() == expected_model.all_component_count());
+        // the failed edit restores the model, so the solvers are kept
+        check_same_result(model, expected_model);
+        CHECK_FALSE(model.calculation_info().contains(create_solver_key));
+    }
+}
+
 TEST_CASE("Test main model - incomplete input") {
     using CalculationMethod::iterative_current;
     using CalculationMethod::linear;
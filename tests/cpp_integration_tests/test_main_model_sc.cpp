@@ -176,4 +176,75 @@ TEST_CASE("Test main model - short circuit - Dataset input") {
     }
 }
 
+namespace {
+auto fault_sweep_model(std::vector<FaultInput> const& fault_input) -> MainModel {
+    MainModel main_model{50.0, meta_data::meta_data_gen::meta_data};
+    main_model.add_component<Node>({{1, 10e3}, {2, 10e3}, {3, 10e3}});
+    main_model.add_component<Line>({{4, 1, 2, 1, 1, 0.1, 0.2, 0.0, 0.0, 0.3, 0.6, 0.0, 0.0, 1e3},
+                                    {5, 2, 3, 1, 1, 0.2, 0.3, 0.0, 0.0, 0.6, 0.9, 0.0, 0.0, 1e3},
+                                    {6, 1, 3, 1, 1, 0.3, 0.3, 0.0, 0.0, 0.9, 0.9, 0.0, 0.0, 1e3}});
+    main_model.add_component<Source>({{7, 1, 1, 1.0, nan, 1e8, 0.1, 1.0}});
+    main_model.add_component<Fault>(fault_input);
+    main_model.set_construction_complete();
+    return main_model;
+}
+} // namespace
+
+TEST_CASE("Test main model - short circuit fault sweep") {
+    std::vector<FaultInput> const fault_input{
+        {10, 1, FaultType::three_phase, FaultPhase::default_value, 2, 0.1, 0.1},
+        {11, 1, FaultType::three_phase, FaultPhase::default_value, 3, 0.0, 0.0},
+        {12, 1, FaultType::single_phase_to_ground, FaultPhase::b, 2, 0.2, 0.0},
+        {13, 1, FaultType::single_phase_to_ground, FaultPhase::default_value, 3, 0.0, 0.0},
+        {14, 1, FaultType::two_phase, FaultPhase::ab, 2, 0.1, 0.2},
+        {15, 1, FaultType::two_phase, FaultPhase::bc, 3, 0.0, 0.0},
+        {16, 1, FaultType::two_phase_to_ground, FaultPhase::ac, 2, 0.2, 0.1},
+        {17, 1, FaultType::two_phase_to_ground, FaultPhase::default_value, 3, 0.0, 0.0},
+        {18, 0, FaultType::three_phase, FaultPhase::default_value, 1, 0.0, 0.0}};
+    auto const n_faults = std::ssize(fault_input);
+    MainModel::Options const options{.calculation_method = CalculationMethod::iec60909,
+                                     .short_circuit_voltage_scaling = ShortCircuitVoltageScaling::maximum};
+
+    auto model = fault_sweep_model(fault_input);
+    std::vector<FaultShortCircuitOutput> fault_output(n_faults);
+    MutableDataset result_data{false, 1, "sc_output", meta_data::meta_data_gen::meta_data};
+    result_data.add_buffer("fault", n_faults, n_faults, nullptr, fault_output.data());
+    model.calculate_short_circuit_sweep(options, result_data);
+
+    // reference by a regular short circuit calculation with only the single fault
+    for (Idx fault = 0; fault != n_faults; ++fault) {
+        CAPTURE(fault);
+        auto ref_model = fault_sweep_model({fault_input[fault]});
+        std::vector<FaultShortCircuitOutput> ref_fault_output(1);
+        MutableDataset ref_result_data{false, 1, "sc_output", meta_data::meta_data_gen::meta_data};
+        ref_result_data.add_buffer("fault", 1, 1, nullptr, ref_fault_output.data());
+        ref_model.calculate_short_circuit(options, ref_result_data);
+
+        FaultShortCircuitOutput const& output = fault_output[fault];
+        FaultShortCircuitOutput const& ref_output = ref_fault_output[0];
+        CHECK(output.id == ref_output.id);
+        CHECK(output.energized == ref_output.energized);
+        for (Idx phase = 0; phase != 3; ++phase) {
+            CAPTURE(phase);
+            CHECK(output.i_f(phase) == doctest::Approx(ref_output.i_f(phase)).epsilon(1e-6).scale(1.0));
+            if (ref_output.i_f(phase) > 1e-6) {
+                CHECK(output.i_f_angle(phase) == doctest::Approx(ref_output.i_f_angle(phase)));
+            }
+        }
+    }
+    CHECK(fault_output[0].i_f(0) > 0.0);
+    CHECK(fault_output[n_faults - 1].energized == 0);
+
+    SUBCASE("Symmetric sweep for three phase faults only") {
+        auto sym_model = fault_sweep_model({fault_input[0], fault_input[1]});
+        std::vector<FaultShortCircuitOutput> sym_fault_output(2);
+        MutableDataset sym_result_data{false, 1, "sc_output", meta_data::meta_data_gen::meta_data};
+        sym_result_data.add_buffer("fault", 2, 2, nullptr, sym_fault_output.data());
+        sym_model.calculate_short_circuit_sweep(options, sym_result_data);
+        for (Idx fault = 0; fault != 2; ++fault) {
+            CHECK(sym_fault_output[fault].i_f(0) == doctest::Approx(fault_output[fault].i_f(0)));
+        }
+    }
+}
+
 } // namespace power_grid_model
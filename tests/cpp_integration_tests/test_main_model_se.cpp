@@ -246,6 +246,27 @@ TEST_CASE_TEMPLATE("Test main model - state estimation", CalculationMethod, Iter
                     CHECK(power_sensor_output[2].p_residual == zero_at_order_of_magnitude); // branch_to
                     CHECK(power_sensor_output[2].q_residual == zero_at_order_of_magnitude); // branch_to
                 }
+                SUBCASE("Observability pre-pass") {
+                    main_model.set_construction_complete();
+                    CHECK_NOTHROW(main_model.check_observability<symmetric_t>(options));
+
+                    // the second scenario disables the only voltage sensor
+                    std::vector<SymVoltageSensorUpdate> const sensor_update{
+                        {11, nan, nan, nan}, {11, std::numeric_limits<double>::infinity(), nan, nan}};
+                    ConstDataset update_data{true, 2, "update", meta_data::meta_data_gen::meta_data};
+                    update_data.add_buffer("sym_voltage_sensor", 1, sensor_update.size(), nullptr,
+                                           sensor_update.data());
+
+                    auto const failed_scenarios = [&main_model, &options, &update_data]() -> IdxVector {
+                        try {
+                            main_model.check_observability<symmetric_t>(options, update_data);
+                        } catch (BatchCalculationError const& e) {
+                            return e.failed_scenarios();
+                        }
+                        return {};
+                    }();
+                    CHECK(failed_scenarios == IdxVector{1});
+                }
             }
         }
         SUBCASE("Forbid Link Power Measurements") {
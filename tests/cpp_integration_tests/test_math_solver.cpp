@@ -453,6 +453,27 @@ TEST_CASE("Test math solver") {
         assert_output(output, output_ref);
     }
 
+    SUBCASE("Test warm started pf solver") {
+        auto const max_iter_key = Timer::make_key(2226, "Max number of iterations");
+        for (auto const method : {newton_raphson, iterative_current}) {
+            CAPTURE(method);
+            MathSolver<symmetric_t> solver{topo_ptr};
+            CalculationInfo info;
+            SolverOutput<symmetric_t> const cold_output =
+                solver.run_power_flow(pf_input, 1e-12, 20, info, method, y_bus_sym);
+            CHECK(info[max_iter_key] > 1.0);
+
+            // start from the solution, it converges in the first iteration
+            PowerFlowInput<symmetric_t> warm_input = pf_input;
+            warm_input.initial_u = cold_output.u;
+            CalculationInfo warm_info;
+            SolverOutput<symmetric_t> const output =
+                solver.run_power_flow(warm_input, 1e-12, 20, warm_info, method, y_bus_sym);
+            assert_output(output, output_ref);
+            CHECK(warm_info[max_iter_key] == 1.0);
+        }
+    }
+
     SUBCASE("Test symmetric linear current pf solver") {
         // low precision
         constexpr auto error_tolerance{5e-3};
@@ -576,6 +597,23 @@ TEST_CASE("Test math solver") {
         assert_output(output, output_ref_z);
     }
 
+    SUBCASE("Test sym se reusing the factorization") {
+        MathSolver<symmetric_t> solver{topo_ptr};
+        CalculationInfo info;
+
+        // the same sensors and variances with different measured values reuse the factorization
+        solver.run_state_estimation(se_input_no_angle, 1e-10, 20, info, iterative_linear, y_bus_sym);
+        SolverOutput<symmetric_t> output =
+            solver.run_state_estimation(se_input_angle, 1e-10, 20, info, iterative_linear, y_bus_sym);
+        assert_output(output, output_ref);
+
+        // a different sensor set refactorizes
+        output = solver.run_state_estimation(se_input_angle_const_z, 1e-10, 20, info, iterative_linear, y_bus_sym);
+        assert_output(output, output_ref_z);
+        output = solver.run_state_estimation(se_input_angle, 1e-10, 20, info, iterative_linear, y_bus_sym);
+        assert_output(output, output_ref);
+    }
+
     SUBCASE("Test sym se with angle and different power variances") {
         MathSolver<symmetric_t> solver{topo_ptr};
         CalculationInfo info;
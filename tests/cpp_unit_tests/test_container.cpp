@@ -6,6 +6,8 @@
 
 #include <doctest/doctest.h>
 
+#include <vector>
+
 namespace power_grid_model {
 
 namespace {
@@ -35,6 +37,19 @@ static_assert(Container<ExtraRetrievableTypes<C>, C1, C2>::is_storageable_v<C1>)
 static_assert(Container<ExtraRetrievableTypes<C>, C1, C2>::is_storageable_v<C2>);
 static_assert(!Container<ExtraRetrievableTypes<C>, C1, C2>::is_storageable_v<C>);
 
+// component with id, for the structural edits
+struct D {
+    D(ID id1, Idx a1) : id_{id1}, a{a1} {}
+    ID id() const { return id_; }
+
+    ID id_;
+    Idx a;
+};
+
+struct D1 : D {
+    using D::D;
+};
+
 static_assert(Container<C1>::is_gettable_v<C1>);
 static_assert(!Container<C1>::is_gettable_v<C2>);
 static_assert(!Container<C1>::is_gettable_v<C>);
@@ -106,6 +121,24 @@ TEST_CASE("Test component container") {
         CHECK(((const_it_end - 6) == it_begin));
     }
 
+    SUBCASE("Test for each") {
+        std::vector<Idx> values;
+        std::vector<Idx> sequences;
+        const_container.for_each<C>([&values, &sequences](auto const& c, Idx seq) {
+            values.push_back(c.a);
+            sequences.push_back(seq);
+        });
+        CHECK(values == std::vector<Idx>{5, 55, 555, 6, 66, 7});
+        CHECK(sequences == std::vector<Idx>{0, 1, 2, 3, 4, 5});
+
+        std::vector<double> b_values;
+        const_container.for_each<C1>([&b_values, &const_container](C1 const& c1, Idx seq) {
+            CHECK(&c1 == &const_container.get_item_by_seq<C1>(seq));
+            b_values.push_back(c1.b);
+        });
+        CHECK(b_values == std::vector<double>{60.0, 660.0});
+    }
+
     SUBCASE("Test get item by idx_2d") {
         C const& c = const_container.get_item<C>({0, 0});
         C const& c1 = const_container.get_item<C>({1, 0});
@@ -126,6 +159,28 @@ TEST_CASE("Test component container") {
         CHECK_THROWS_AS(container.get_item<C>(8), IDNotFound);
     }
 
+    SUBCASE("Test get idx_2d of multiple ids") {
+        std::vector<ID> ids{22, 1, 3, 111};
+        std::vector<Idx2D> result(ids.size());
+        const_container.get_idx_by_id<C>(ids, result);
+        CHECK(result == std::vector<Idx2D>{{1, 1}, {0, 0}, {2, 0}, {0, 2}});
+
+        ids = {2, 22};
+        result.resize(ids.size());
+        const_container.get_idx_by_id<C1>(ids, result);
+        CHECK(result == std::vector<Idx2D>{{1, 0}, {1, 1}});
+
+        ids = {2, 3, 8};
+        result.resize(ids.size());
+        CHECK_THROWS_AS(const_container.get_idx_by_id<C1>(ids, result), IDWrongType);
+        ids = {2, 8, 3};
+        CHECK_THROWS_AS(const_container.get_idx_by_id<C1>(ids, result), IDNotFound);
+
+        // without throwing, the ids which are not found or of the wrong type are not_found
+        const_container.find_idx_by_id<C1>(ids, result);
+        CHECK(result == std::vector<Idx2D>{{1, 0}, IdIndex::not_found, IdIndex::not_found});
+    }
+
     SUBCASE("Test size of a component class collection") {
         CHECK(const_container.size<C>() == 6);
         CHECK(const_container.size<C1>() == 2);
@@ -168,6 +223,21 @@ TEST_CASE("Test component container") {
         CHECK(const_container.get_idx_2d_by_seq<C2>(0) == Idx2D{2, 0});
     }
 
+    SUBCASE("Test get idx_2d based on sequence with empty storage") {
+        CompContainer sparse_container;
+        sparse_container.emplace<C>(1, 5);
+        sparse_container.emplace<C2>(3, 7, 70);
+        sparse_container.emplace<C2>(33, 77, 770);
+        sparse_container.set_construction_complete();
+
+        CHECK(sparse_container.get_idx_2d_by_seq<C>(0) == Idx2D{0, 0});
+        CHECK(sparse_container.get_idx_2d_by_seq<C>(1) == Idx2D{2, 0});
+        CHECK(sparse_container.get_idx_2d_by_seq<C>(2) == Idx2D{2, 1});
+        CHECK(sparse_container.get_idx_2d_by_seq<C2>(1) == Idx2D{2, 1});
+        CHECK(sparse_container.get_item_by_seq<C>(2).a == 77);
+        CHECK(sparse_container.size<C1>() == 0);
+    }
+
     SUBCASE("Test get component based on sequence") {
         CHECK(const_container.get_item_by_seq<C>(0).a == 5);
         CHECK(const_container.get_item_by_seq<C>(1).a == 55);
@@ -195,4 +265,70 @@ TEST_CASE("Test component container") {
     }
 }
 
+TEST_CASE("Test component container - structural edits") {
+    using CompContainer = Container<D, D1>;
+
+    CompContainer container;
+    container.emplace<D>(1, 1, 10);
+    container.emplace<D>(2, 2, 20);
+    container.emplace<D>(3, 3, 30);
+    container.emplace<D1>(4, 4, 40);
+    container.emplace<D1>(5, 5, 50);
+    container.set_construction_complete();
+
+    auto const check_items = [&container](std::vector<Idx> const& expected) {
+        REQUIRE(container.size<D>() == static_cast<Idx>(expected.size()));
+        for (Idx seq = 0; seq != container.size<D>(); ++seq) {
+            CAPTURE(seq);
+            D const& item = container.get_item_by_seq<D>(seq);
+            CHECK(item.a == expected[seq]);
+            CHECK(container.get_item<D>(item.id()).a == expected[seq]);
+            CHECK(container.get_seq<D>(item.id()) == seq);
+        }
+    };
+
+    SUBCASE("Erase") {
+        std::vector<ID> const ids{4, 1, 1};
+        container.erase(ids);
+        container.set_construction_complete();
+        check_items({20, 30, 50});
+        CHECK(container.size<D1>() == 1);
+        CHECK_THROWS_AS(container.get_idx_by_id(1), IDNotFound);
+        CHECK_THROWS_AS(container.get_idx_by_id(4), IDNotFound);
+    }
+
+    SUBCASE("Erase unknown id") {
+        std::vector<ID> const ids{2, 6};
+        CHECK_THROWS_AS(container.erase(ids), IDNotFound);
+        container.set_construction_complete();
+        check_items({10, 20, 30, 40, 50});
+    }
+
+    SUBCASE("Add and truncate") {
+        auto const sizes = container.storage_sizes();
+        container.reopen_construction();
+        container.emplace<D>(6, 6, 60);
+        container.emplace<D1>(7, 7, 70);
+        container.set_construction_complete();
+        check_items({10, 20, 30, 60, 40, 50, 70});
+
+        container.reopen_construction();
+        container.truncate(sizes);
+        container.set_construction_complete();
+        check_items({10, 20, 30, 40, 50});
+        CHECK_THROWS_AS(container.get_idx_by_id(6), IDNotFound);
+    }
+
+    SUBCASE("Truncate after conflicting id") {
+        auto const sizes = container.storage_sizes();
+        container.reopen_construction();
+        std::vector<ID> const ids{8, 2};
+        CHECK_THROWS_AS(container.append(ids, std::vector<D1>{{8, 80}, {2, 90}}), ConflictID);
+        container.truncate(sizes);
+        container.set_construction_complete();
+        check_items({10, 20, 30, 40, 50});
+        CHECK_THROWS_AS(container.get_idx_by_id(8), IDNotFound);
+    }
+}
+
 } // namespace power_grid_model
\ No newline at end of file
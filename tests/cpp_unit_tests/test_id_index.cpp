@@ -0,0 +1,136 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <power_grid_model/common/id_index.hpp>
+
+#include <doctest/doctest.h>
+
+#include <limits>
+#include <vector>
+
+namespace power_grid_model {
+
+TEST_CASE("Test ID index") {
+    IdIndex index;
+    CHECK(index.size() == 0);
+    CHECK(!index.contains(1));
+    CHECK(index.find(1) == IdIndex::not_found);
+
+    SUBCASE("Sparse IDs") {
+        std::vector<ID> const ids{std::numeric_limits<ID>::min(), -7, 0, 3, 1000, std::numeric_limits<ID>::max()};
+        for (Idx i = 0; i != static_cast<Idx>(ids.size()); ++i) {
+            CHECK(index.insert(ids[i], {i % 2, i}));
+        }
+        CHECK(!index.insert(3, {0, 100}));
+        CHECK(index.size() == 6);
+
+        index.compact();
+        CHECK(!index.is_dense());
+        for (Idx i = 0; i != static_cast<Idx>(ids.size()); ++i) {
+            CHECK(index.find(ids[i]) == Idx2D{i % 2, i});
+        }
+        CHECK(index.find(1) == IdIndex::not_found);
+    }
+
+    SUBCASE("Many IDs") {
+        // more than the initial capacity and with colliding low bits
+        constexpr Idx n_ids = 1000;
+        for (Idx i = 0; i != n_ids; ++i) {
+            CHECK(index.insert(static_cast<ID>(i * 1024), {0, i}));
+        }
+        CHECK(index.size() == n_ids);
+        for (Idx i = 0; i != n_ids; ++i) {
+            CHECK(index.find(static_cast<ID>(i * 1024)) == Idx2D{0, i});
+            CHECK(!index.contains(static_cast<ID>(i * 1024 + 1)));
+        }
+    }
+
+    SUBCASE("Dense IDs") {
+        for (Idx i = 0; i != 10; ++i) {
+            CHECK(index.insert(static_cast<ID>(-2 + 2 * i), {1, i}));
+        }
+        index.compact();
+        CHECK(index.is_dense());
+        CHECK(index.find(-2) == Idx2D{1, 0});
+        CHECK(index.find(16) == Idx2D{1, 9});
+        CHECK(index.find(-1) == IdIndex::not_found);
+        CHECK(index.find(-3) == IdIndex::not_found);
+        CHECK(index.find(17) == IdIndex::not_found);
+
+        // insert in the range keeps the dense layout
+        CHECK(index.insert(-1, {0, 0}));
+        CHECK(!index.insert(0, {0, 1}));
+        CHECK(index.is_dense());
+        CHECK(index.find(-1) == Idx2D{0, 0});
+
+        // insert out of the range switches back to the hash layout
+        CHECK(index.insert(100, {0, 1}));
+        CHECK(!index.is_dense());
+        CHECK(index.size() == 12);
+        CHECK(index.find(-1) == Idx2D{0, 0});
+        CHECK(index.find(16) == Idx2D{1, 9});
+        CHECK(index.find(100) == Idx2D{0, 1});
+    }
+
+    SUBCASE("Erase and assign") {
+        // colliding low bits, so that the erased entries are in the middle of probe sequences
+        constexpr Idx n_ids = 200;
+        for (Idx i = 0; i != n_ids; ++i) {
+            CHECK(index.insert(static_cast<ID>(i * 1024), {0, i}));
+        }
+        for (Idx i = 0; i < n_ids; i += 3) {
+            CHECK(index.erase(static_cast<ID>(i * 1024)));
+        }
+        CHECK(!index.erase(0));
+        CHECK(!index.erase(1));
+        CHECK(index.size() == n_ids - (n_ids + 2) / 3);
+        for (Idx i = 0; i != n_ids; ++i) {
+            CAPTURE(i);
+            CHECK(index.find(static_cast<ID>(i * 1024)) == (i % 3 == 0 ? IdIndex::not_found : Idx2D{0, i}));
+        }
+
+        CHECK(index.assign(1024, {1, 5}));
+        CHECK(!index.assign(0, {1, 6}));
+        CHECK(index.find(1024) == Idx2D{1, 5});
+        CHECK(index.insert(0, {1, 0}));
+        CHECK(index.find(0) == Idx2D{1, 0});
+
+        SUBCASE("Dense layout") {
+            index = IdIndex{};
+            for (Idx i = 0; i != 10; ++i) {
+                CHECK(index.insert(static_cast<ID>(i), {0, i}));
+            }
+            index.compact();
+            REQUIRE(index.is_dense());
+            CHECK(index.erase(3));
+            CHECK(!index.erase(3));
+            CHECK(!index.erase(20));
+            CHECK(index.size() == 9);
+            CHECK(index.find(3) == IdIndex::not_found);
+            CHECK(index.assign(4, {0, 3}));
+            CHECK(!index.assign(3, {0, 3}));
+            CHECK(index.find(4) == Idx2D{0, 3});
+            CHECK(index.is_dense());
+        }
+    }
+
+    SUBCASE("Bulk find") {
+        for (Idx i = 0; i != 40; ++i) {
+            index.insert(static_cast<ID>(i * i), {0, i});
+        }
+        std::vector<ID> ids;
+        std::vector<Idx2D> expected;
+        for (Idx i = 39; i >= 0; --i) {
+            ids.push_back(static_cast<ID>(i * i));
+            expected.push_back({0, i});
+            ids.push_back(static_cast<ID>(i * i + 2)); // never a square
+            expected.push_back(IdIndex::not_found);
+        }
+        std::vector<Idx2D> result(ids.size());
+        index.find(ids, result);
+        CHECK(result == expected);
+    }
+}
+
+} // namespace power_grid_model
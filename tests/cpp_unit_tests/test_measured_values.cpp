@@ -129,6 +129,69 @@ TEST_CASE("Measured Values") {
         check_close<asymmetric_t>(injection.p_variance, RealValue<asymmetric_t>{0.3, 0.2, 0.85});
         check_close<asymmetric_t>(injection.q_variance, RealValue<asymmetric_t>{0.7, 0.85, 0.2});
     }
+
+    SUBCASE("Refresh with the same sensor configuration") {
+        auto topo = MathModelTopology{};
+        topo.phase_shift = {0.0, 0.0};
+        topo.branch_bus_idx = {{0, 1}};
+        topo.shunts_per_bus = {from_dense, {}, 2};
+        topo.load_gens_per_bus = {from_dense, {1}, 2};
+        topo.sources_per_bus = {from_dense, {0}, 2};
+        topo.voltage_sensors_per_bus = {from_dense, {0, 1}, 2};
+        topo.power_sensors_per_source = {from_dense, {}, 1};
+        topo.power_sensors_per_load_gen = {from_dense, {0}, 1};
+        topo.power_sensors_per_shunt = {from_dense, {}, 0};
+        topo.power_sensors_per_branch_from = {from_dense, {0}, 1};
+        topo.power_sensors_per_branch_to = {from_dense, {}, 1};
+        topo.power_sensors_per_bus = {from_dense, {0}, 2};
+        auto const topo_ptr = std::make_shared<MathModelTopology const>(std::move(topo));
+
+        StateEstimationInput<symmetric_t> input{};
+        input.source_status = {1};
+        input.load_gen_status = {1};
+        input.measured_voltage = {{1.0 + 0.1i, 0.5}, {0.9 + 0.0i, 1.0}};
+        input.measured_bus_injection = {{1.0 + 0.5i, 0.5, 0.5}};
+        input.measured_load_gen_power = {{-1.0 - 0.4i, 0.2, 0.3}};
+        input.measured_branch_from_power = {{0.9 + 0.4i, 0.4, 0.4}};
+
+        StateEstimationInput<symmetric_t> new_input = input;
+        new_input.measured_voltage = {{1.02 + 0.0i, 0.25}, {0.95 + 0.05i, 2.0}};
+        new_input.measured_bus_injection = {{1.2 + 0.6i, 0.1, 0.3}};
+        new_input.measured_load_gen_power = {{-1.1 - 0.5i, 0.4, 0.1}};
+        new_input.measured_branch_from_power = {{1.1 + 0.5i, 0.2, 0.6}};
+
+        MeasuredValues<symmetric_t> values{topo_ptr, input};
+        REQUIRE(values.refresh(new_input));
+        MeasuredValues<symmetric_t> const ref_values{topo_ptr, new_input};
+
+        for (Idx bus = 0; bus != 2; ++bus) {
+            CAPTURE(bus);
+            REQUIRE(values.has_voltage(bus) == ref_values.has_voltage(bus));
+            check_close(values.voltage(bus), ref_values.voltage(bus));
+            check_close(values.voltage_var(bus), ref_values.voltage_var(bus));
+            REQUIRE(values.has_bus_injection(bus) == ref_values.has_bus_injection(bus));
+            check_close(values.bus_injection(bus).value, ref_values.bus_injection(bus).value);
+            check_close(values.bus_injection(bus).p_variance, ref_values.bus_injection(bus).p_variance);
+            check_close(values.bus_injection(bus).q_variance, ref_values.bus_injection(bus).q_variance);
+        }
+        check_close(values.branch_from_power(0).value, ref_values.branch_from_power(0).value);
+        check_close(values.branch_from_power(0).p_variance, ref_values.branch_from_power(0).p_variance);
+        check_close(values.load_gen_power(0).value, ref_values.load_gen_power(0).value);
+        check_close(values.mean_angle_shift(), ref_values.mean_angle_shift());
+
+        SUBCASE("Different status") {
+            new_input.load_gen_status = {0};
+            CHECK_FALSE(values.refresh(new_input));
+        }
+        SUBCASE("Invalid voltage measurement") {
+            new_input.measured_voltage[1].variance = std::numeric_limits<double>::infinity();
+            CHECK_FALSE(values.refresh(new_input));
+        }
+        SUBCASE("Different voltage angle measurement") {
+            new_input.measured_voltage[0].value = {1.02, nan};
+            CHECK_FALSE(values.refresh(new_input));
+        }
+    }
 }
 
 } // namespace power_grid_model::math_solver
\ No newline at end of file
@@ -8,6 +8,9 @@
 
 #include <doctest/doctest.h>
 
+#include <algorithm>
+#include <optional>
+
 namespace power_grid_model {
 
 namespace {
@@ -18,12 +21,20 @@ void check_not_observable(MathModelTopology const& topo, MathModelParam<symmetri
     YBus<symmetric_t> const y_bus{topo_ptr, param_ptr};
     math_solver::MeasuredValues<symmetric_t> const measured_values{y_bus.shared_topology(), se_input};
 
-    CHECK_THROWS_AS(math_solver::necessary_observability_check(measured_values, y_bus.shared_topology()),
+    CHECK_THROWS_AS(math_solver::observability_check(measured_values, y_bus.shared_topology()),
                     NotObservableError);
+    try {
+        math_solver::observability_check(measured_values, y_bus.shared_topology());
+    } catch (NotObservableError const& e) {
+        // the error describes the observable islands of the buses
+        CHECK(std::ssize(e.bus_island()) == topo.n_bus());
+        CHECK(e.n_islands() >= 1);
+        CHECK(std::ranges::all_of(e.bus_island(), [&e](Idx island) { return island >= 0 && island < e.n_islands(); }));
+    }
 }
 } // namespace
 
-TEST_CASE("Necessary observability check") {
+TEST_CASE("Observability check") {
     /*
                   /-branch_0-\
             bus_2              bus_1 --branch_0-- bus_0 -- source
@@ -37,7 +48,7 @@ TEST_CASE("Necessary observability check") {
     topo.shunts_per_bus = {from_sparse, {0, 0, 0, 0}};
     topo.load_gens_per_bus = {from_sparse, {0, 0, 1, 2}};
     topo.load_gen_type = {LoadGenType::const_pq, LoadGenType::const_pq};
-    topo.power_sensors_per_bus = {from_sparse, {0, 0, 0, 1}};
+    topo.power_sensors_per_bus = {from_sparse, {0, 0, 1, 1}};
     topo.power_sensors_per_source = {from_sparse, {0, 0}};
     topo.power_sensors_per_load_gen = {from_sparse, {0, 0, 0}};
     topo.power_sensors_per_shunt = {from_sparse, {0}};
@@ -61,7 +72,19 @@ TEST_CASE("Necessary observability check") {
         auto topo_ptr = std::make_shared<MathModelTopology const>(topo);
         YBus<symmetric_t> const y_bus{topo_ptr, param_ptr};
         math_solver::MeasuredValues<symmetric_t> const measured_values{y_bus.shared_topology(), se_input};
-        CHECK_NOTHROW(math_solver::necessary_observability_check(measured_values, y_bus.shared_topology()));
+        CHECK_NOTHROW(math_solver::observability_check(measured_values, y_bus.shared_topology()));
+    }
+
+    SUBCASE("Enough sensors at the wrong location") {
+        // the injection of bus_2 only adds the flows of the parallel branches, bus_0 is not connected to the others
+        topo.power_sensors_per_bus = {from_sparse, {0, 0, 0, 1}};
+        check_not_observable(topo, param, se_input);
+
+        auto const topo_ptr = std::make_shared<MathModelTopology const>(topo);
+        math_solver::MeasuredValues<symmetric_t> const measured_values{topo_ptr, se_input};
+        auto const result = math_solver::observability_analysis(measured_values, *topo_ptr);
+        CHECK(result.n_islands == 2);
+        CHECK(result.bus_island == IdxVector{0, 1, 1});
     }
 
     SUBCASE("No voltage sensor") {
@@ -93,4 +116,188 @@ TEST_CASE("Necessary observability check") {
     }
 }
 
+TEST_CASE("Observability analysis") {
+    /*
+        source -- bus_0 --branch_0-- bus_1 --branch_1-- bus_2 --branch_2-- bus_3
+                                      |                   |                  |
+                                  load_gen_0          load_gen_1         load_gen_2
+    */
+    MathModelTopology topo;
+    topo.slack_bus = 0;
+    topo.phase_shift = {0.0, 0.0, 0.0, 0.0};
+    topo.branch_bus_idx = {{0, 1}, {1, 2}, {2, 3}};
+    topo.sources_per_bus = {from_sparse, {0, 1, 1, 1, 1}};
+    topo.shunts_per_bus = {from_sparse, {0, 0, 0, 0, 0}};
+    topo.load_gens_per_bus = {from_sparse, {0, 0, 1, 2, 3}};
+    topo.load_gen_type = {LoadGenType::const_pq, LoadGenType::const_pq, LoadGenType::const_pq};
+    topo.power_sensors_per_bus = {from_sparse, {0, 0, 0, 0, 0}};
+    topo.power_sensors_per_source = {from_sparse, {0, 0}};
+    topo.power_sensors_per_load_gen = {from_sparse, {0, 0, 0, 0}};
+    topo.power_sensors_per_shunt = {from_sparse, {0}};
+    topo.power_sensors_per_branch_from = {from_sparse, {0, 0, 0, 1}};
+    topo.power_sensors_per_branch_to = {from_sparse, {0, 0, 0, 0}};
+    topo.voltage_sensors_per_bus = {from_sparse, {0, 1, 1, 2, 2}};
+
+    StateEstimationInput<symmetric_t> se_input;
+    se_input.source_status = {1};
+    se_input.load_gen_status = {1, 1, 1};
+    se_input.measured_voltage = {{1.0 + 0.0i, 1.0}, {1.0 + 0.0i, 1.0}};
+    se_input.measured_branch_from_power = {{1.0, 1.0, 1.0}};
+
+    auto const analyse = [&topo, &se_input] {
+        auto const topo_ptr = std::make_shared<MathModelTopology const>(topo);
+        math_solver::MeasuredValues<symmetric_t> const measured_values{topo_ptr, se_input};
+        return math_solver::observability_analysis(measured_values, *topo_ptr);
+    };
+
+    SUBCASE("Unobservable island") {
+        // bus_1 is not connected to the voltage phasors by any measurement
+        auto const result = analyse();
+        CHECK(!result.is_observable);
+        CHECK(result.n_islands == 2);
+        CHECK(result.bus_island == IdxVector{0, 1, 0, 0});
+    }
+
+    SUBCASE("Injection between voltage phasors") {
+        topo.power_sensors_per_load_gen = {from_sparse, {0, 1, 1, 1}};
+        se_input.measured_load_gen_power = {{1.0, 1.0, 1.0}};
+        auto const result = analyse();
+        CHECK(result.is_observable);
+        CHECK(result.n_islands == 1);
+    }
+
+    SUBCASE("Islands without voltage phasor") {
+        // setting only real part of measurement makes it magnitude sensor
+        se_input.measured_voltage = {{{1.0, nan}, 1.0}, {{1.0, nan}, 1.0}};
+        auto const result = analyse();
+        CHECK(!result.is_observable);
+        CHECK(result.n_islands == 3);
+        CHECK(result.bus_island == IdxVector{0, 1, 2, 2});
+
+        SUBCASE("Injections merged in turn") {
+            // the injection of bus_2 touches three islands, until the injection of bus_3 merged bus_2 and bus_3
+            topo.power_sensors_per_branch_from = {from_sparse, {0, 0, 0, 0}};
+            topo.power_sensors_per_load_gen = {from_sparse, {0, 0, 1, 2}};
+            se_input.measured_branch_from_power = {};
+            se_input.measured_load_gen_power = {{1.0, 1.0, 1.0}, {1.0, 1.0, 1.0}};
+            auto const merged_result = analyse();
+            CHECK(merged_result.n_islands == 2);
+            CHECK(merged_result.bus_island == IdxVector{0, 1, 1, 1});
+        }
+    }
+}
+
+TEST_CASE("Observability of a meshed grid") {
+    /*
+        source -- bus_0 --branch_0-- bus_1
+                    |                  |
+                branch_3           branch_1
+                    |                  |
+                  bus_3 --branch_2-- bus_2
+                    |
+                branch_4
+                    |
+                  bus_4 -- load_gen_0
+    */
+    MathModelTopology topo;
+    topo.slack_bus = 0;
+    topo.phase_shift = {0.0, 0.0, 0.0, 0.0, 0.0};
+    topo.branch_bus_idx = {{0, 1}, {1, 2}, {2, 3}, {3, 0}, {3, 4}};
+    topo.sources_per_bus = {from_sparse, {0, 1, 1, 1, 1, 1}};
+    topo.shunts_per_bus = {from_sparse, {0, 0, 0, 0, 0, 0}};
+    topo.load_gens_per_bus = {from_sparse, {0, 0, 0, 0, 0, 1}};
+    topo.load_gen_type = {LoadGenType::const_pq};
+    topo.power_sensors_per_bus = {from_sparse, {0, 1, 1, 1, 1, 1}};
+    topo.power_sensors_per_source = {from_sparse, {0, 0}};
+    topo.power_sensors_per_load_gen = {from_sparse, {0, 0}};
+    topo.power_sensors_per_shunt = {from_sparse, {0}};
+    topo.power_sensors_per_branch_from = {from_sparse, {0, 0, 0, 0, 0, 0}};
+    topo.power_sensors_per_branch_to = {from_sparse, {0, 0, 0, 0, 0, 0}};
+    topo.voltage_sensors_per_bus = {from_sparse, {0, 1, 1, 1, 1, 1}};
+
+    StateEstimationInput<symmetric_t> se_input;
+    se_input.source_status = {1};
+    se_input.load_gen_status = {1};
+    se_input.measured_voltage = {{{1.0, nan}, 1.0}};
+    se_input.measured_bus_injection = {{1.0, 1.0, 1.0}};
+
+    auto const analyse = [&topo, &se_input] {
+        auto const topo_ptr = std::make_shared<MathModelTopology const>(topo);
+        math_solver::MeasuredValues<symmetric_t> const measured_values{topo_ptr, se_input};
+        return math_solver::observability_analysis(measured_values, *topo_ptr);
+    };
+
+    SUBCASE("Injections in the mesh") {
+        // the injections of bus_0 to bus_3 each touch three islands, together they determine all angles
+        auto const result = analyse();
+        CHECK(result.is_observable);
+        CHECK(result.n_islands == 1);
+        CHECK(result.bus_island == IdxVector{0, 0, 0, 0, 0});
+    }
+
+    SUBCASE("Redundant measurements in the mesh") {
+        // the branch measurement and the injections of bus_0 to bus_2 only determine the angles of the mesh,
+        //    although there are as many measurements as unknown angle differences
+        topo.load_gens_per_bus = {from_sparse, {0, 0, 0, 0, 1, 2}};
+        topo.load_gen_type = {LoadGenType::const_pq, LoadGenType::const_pq};
+        topo.power_sensors_per_load_gen = {from_sparse, {0, 0, 0}};
+        topo.power_sensors_per_branch_from = {from_sparse, {0, 1, 1, 1, 1, 1}};
+        se_input.load_gen_status = {1, 1};
+        se_input.measured_branch_from_power = {{1.0, 1.0, 1.0}};
+        auto const result = analyse();
+        CHECK(!result.is_observable);
+        CHECK(result.n_islands == 2);
+        CHECK(result.bus_island == IdxVector{0, 0, 0, 0, 1});
+    }
+}
+
+TEST_CASE("Observability of refreshed measured values") {
+    /*
+        source -- bus_0 --branch_0-- bus_1 --branch_1-- bus_2
+                                      |                   |
+                                  load_gen_0          load_gen_1
+    */
+    MathModelTopology topo;
+    topo.slack_bus = 0;
+    topo.phase_shift = {0.0, 0.0, 0.0};
+    topo.branch_bus_idx = {{0, 1}, {1, 2}};
+    topo.sources_per_bus = {from_sparse, {0, 1, 1, 1}};
+    topo.shunts_per_bus = {from_sparse, {0, 0, 0, 0}};
+    topo.load_gens_per_bus = {from_sparse, {0, 0, 1, 2}};
+    topo.load_gen_type = {LoadGenType::const_pq, LoadGenType::const_pq};
+    topo.power_sensors_per_bus = {from_sparse, {0, 0, 0, 0}};
+    topo.power_sensors_per_source = {from_sparse, {0, 0}};
+    topo.power_sensors_per_load_gen = {from_sparse, {0, 0, 0}};
+    topo.power_sensors_per_shunt = {from_sparse, {0}};
+    topo.power_sensors_per_branch_from = {from_sparse, {0, 0, 1}};
+    topo.power_sensors_per_branch_to = {from_sparse, {0, 0, 0}};
+    topo.voltage_sensors_per_bus = {from_sparse, {0, 1, 2, 2}};
+    auto const topo_ptr = std::make_shared<MathModelTopology const>(topo);
+
+    // observable with the voltage phasors of bus_0 and bus_1, not observable with only their magnitudes
+    StateEstimationInput<symmetric_t> phasor_input;
+    phasor_input.source_status = {1};
+    phasor_input.load_gen_status = {1, 1};
+    phasor_input.measured_voltage = {{1.0 + 0.0i, 1.0}, {1.0 + 0.0i, 1.0}};
+    phasor_input.measured_branch_from_power = {{1.0, 1.0, 1.0}};
+    StateEstimationInput<symmetric_t> magnitude_input = phasor_input;
+    magnitude_input.measured_voltage = {{{1.0, nan}, 1.0}, {{1.0, nan}, 1.0}};
+
+    std::optional<math_solver::MeasuredValues<symmetric_t>> cached;
+    bool is_observable{};
+
+    SUBCASE("Angle measurements removed") {
+        CHECK_NOTHROW(math_solver::refresh_observable_measured_values(cached, is_observable, topo_ptr, phasor_input));
+        CHECK_THROWS_AS(
+            math_solver::refresh_observable_measured_values(cached, is_observable, topo_ptr, magnitude_input),
+            NotObservableError);
+    }
+    SUBCASE("Angle measurements added") {
+        CHECK_THROWS_AS(
+            math_solver::refresh_observable_measured_values(cached, is_observable, topo_ptr, magnitude_input),
+            NotObservableError);
+        CHECK_NOTHROW(math_solver::refresh_observable_measured_values(cached, is_observable, topo_ptr, phasor_input));
+    }
+}
+
 } // namespace power_grid_model
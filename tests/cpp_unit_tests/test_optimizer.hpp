@@ -141,7 +141,7 @@ static_assert(std::convertible_to<decltype(stub_const_dataset_update), ConstData
 
 constexpr auto strategies = [] {
     using enum OptimizerStrategy;
-    return std::array{any, global_minimum, global_maximum, local_minimum, local_maximum};
+    return std::array{any, global_minimum, global_maximum, local_minimum, local_maximum, fast_any};
 }();
 
 constexpr auto calculation_methods = [] {
@@ -0,0 +1,123 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <power_grid_model/common/three_phase_tensor.hpp>
+#include <power_grid_model/math_solver/common_solver_functions.hpp>
+#include <power_grid_model/math_solver/sequence_decoupled_solver.hpp>
+#include <power_grid_model/math_solver/sparse_lu_solver.hpp>
+#include <power_grid_model/math_solver/y_bus.hpp>
+
+#include <doctest/doctest.h>
+
+namespace power_grid_model::math_solver {
+
+TEST_CASE("Test balanced sequence components") {
+    SUBCASE("Balanced block") {
+        // self and mutual admittance
+        ComplexTensor<asymmetric_t> const block{3.0 - 6.0i, 1.0 + 0.5i};
+        auto const components = balanced_sequence_components(block);
+        REQUIRE(components.has_value());
+        // zero sequence: s + 2m, positive and negative sequence: s - m
+        CHECK(cabs(components.value()(0) - (5.0 - 5.0i)) < numerical_tolerance);
+        CHECK(cabs(components.value()(1) - (2.0 - 6.5i)) < numerical_tolerance);
+        CHECK(cabs(components.value()(2) - (2.0 - 6.5i)) < numerical_tolerance);
+    }
+
+    SUBCASE("Phase shift block") {
+        // phase shift of 30 degrees in the positive sequence, and -30 degrees in the negative sequence
+        ComplexTensor<asymmetric_t> block;
+        block << 1.0, 0.0, -1.0, -1.0, 1.0, 0.0, 0.0, -1.0, 1.0;
+        auto const components = balanced_sequence_components(block);
+        REQUIRE(components.has_value());
+        CHECK(components.value()(0) == 0.0);
+        CHECK(cabs(components.value()(1) - (1.0 - a)) < numerical_tolerance);
+        CHECK(cabs(components.value()(2) - (1.0 - a2)) < numerical_tolerance);
+    }
+
+    SUBCASE("Zero block") { CHECK(balanced_sequence_components(ComplexTensor<asymmetric_t>{}).has_value()); }
+
+    SUBCASE("Unbalanced block") {
+        ComplexTensor<asymmetric_t> block{3.0 - 6.0i, 1.0 + 0.5i};
+        block(1, 1) += 1.0;
+        CHECK(!balanced_sequence_components(block).has_value());
+    }
+}
+
+TEST_CASE("Test sequence decoupled solver") {
+    // [0] --0--> [1] --1--> [2]
+    //  |                     |
+    // shunt 0             shunt 1
+    MathModelTopology topo{};
+    topo.phase_shift.resize(3, 0.0);
+    topo.branch_bus_idx = {{0, 1}, {1, 2}};
+    topo.shunts_per_bus = {from_sparse, {0, 1, 1, 2}};
+
+    ComplexTensor<asymmetric_t> const y_line{2.0 - 8.0i, -0.5 + 1.0i};
+    ComplexTensor<asymmetric_t> const y_shunt{1.0 + 0.5i, 0.1i};
+    MathModelParam<asymmetric_t> param;
+    param.branch_param = {{y_line, -y_line, -y_line, y_line}, {y_line, -y_line, -y_line, y_line}};
+    param.shunt_param = {y_shunt, 2.0 * y_shunt};
+
+    ComplexValueVector<asymmetric_t> const rhs{
+        {1.0 + 2.0i, -0.5i, 3.0}, {-1.0, 0.3 - 0.2i, 2.0i}, {0.5 + 0.5i, 1.0, -1.0 - 1.0i}};
+
+    auto solve_block = [&rhs](YBus<asymmetric_t> const& y_bus) {
+        ComplexTensorVector<asymmetric_t> mat_data(y_bus.nnz_lu());
+        detail::copy_y_bus<asymmetric_t>(y_bus, mat_data);
+        SparseLUSolver<ComplexTensor<asymmetric_t>, ComplexValue<asymmetric_t>, ComplexValue<asymmetric_t>> solver{
+            y_bus.shared_indptr_lu(), y_bus.shared_indices_lu(), y_bus.shared_diag_lu()};
+        SparseLUSolver<ComplexTensor<asymmetric_t>, ComplexValue<asymmetric_t>,
+                       ComplexValue<asymmetric_t>>::BlockPermArray perm(y_bus.size());
+        ComplexValueVector<asymmetric_t> x(y_bus.size());
+        solver.prefactorize_and_solve(mat_data, perm, rhs, x);
+        return x;
+    };
+
+    SUBCASE("Balanced network") {
+        auto const topo_ptr = std::make_shared<MathModelTopology const>(topo);
+        YBus<asymmetric_t> const y_bus{topo_ptr, std::make_shared<MathModelParam<asymmetric_t> const>(param)};
+        ComplexTensorVector<asymmetric_t> mat_data(y_bus.nnz_lu());
+        detail::copy_y_bus<asymmetric_t>(y_bus, mat_data);
+
+        auto const sequence_solver = SequenceDecoupledSolver::factorize(y_bus, mat_data);
+        REQUIRE(sequence_solver.has_value());
+        ComplexValueVector<asymmetric_t> x(y_bus.size());
+        sequence_solver->solve(rhs, x);
+
+        ComplexValueVector<asymmetric_t> const x_ref = solve_block(y_bus);
+        for (Idx bus = 0; bus != y_bus.size(); ++bus) {
+            CHECK((cabs(x[bus] - x_ref[bus]) < numerical_tolerance).all());
+        }
+
+        // in place
+        ComplexValueVector<asymmetric_t> x_in_place = rhs;
+        sequence_solver->solve(x_in_place, x_in_place);
+        for (Idx bus = 0; bus != y_bus.size(); ++bus) {
+            CHECK((cabs(x_in_place[bus] - x_ref[bus]) < numerical_tolerance).all());
+        }
+    }
+
+    SUBCASE("Unbalanced network") {
+        param.shunt_param[1](0, 0) += 1.0;
+        auto const topo_ptr = std::make_shared<MathModelTopology const>(topo);
+        YBus<asymmetric_t> const y_bus{topo_ptr, std::make_shared<MathModelParam<asymmetric_t> const>(param)};
+        ComplexTensorVector<asymmetric_t> mat_data(y_bus.nnz_lu());
+        detail::copy_y_bus<asymmetric_t>(y_bus, mat_data);
+        CHECK(!SequenceDecoupledSolver::factorize(y_bus, mat_data).has_value());
+    }
+
+    SUBCASE("Singular sequence network") {
+        // no zero sequence admittance at all, like a delta connected network
+        ComplexTensor<asymmetric_t> const y_delta{2.0 - 4.0i, -1.0 + 2.0i};
+        param.branch_param = {{y_delta, -y_delta, -y_delta, y_delta}, {y_delta, -y_delta, -y_delta, y_delta}};
+        param.shunt_param = {y_delta, 2.0 * y_delta};
+        auto const topo_ptr = std::make_shared<MathModelTopology const>(topo);
+        YBus<asymmetric_t> const y_bus{topo_ptr, std::make_shared<MathModelParam<asymmetric_t> const>(param)};
+        ComplexTensorVector<asymmetric_t> mat_data(y_bus.nnz_lu());
+        detail::copy_y_bus<asymmetric_t>(y_bus, mat_data);
+        CHECK(!SequenceDecoupledSolver::factorize(y_bus, mat_data).has_value());
+    }
+}
+
+} // namespace power_grid_model::math_solver
@@ -83,6 +83,17 @@ TEST_CASE("Test Sparse LU solver") {
             solver.prefactorize_and_solve(data, block_perm, rhs, x);
             CHECK(prefactorized_data == data);
         }
+
+        SUBCASE("Test low-rank update") {
+            // [4 1 5        3          21
+            //  3 9 1     * [-1]   =  [ 2 ]
+            //  2 -1 6]      2          19
+            solver.prefactorize(data, block_perm);
+            SparseLUSolver<double, double, double>::DenseMatrix delta(2, 2);
+            delta << 2.0, 1.0, -1.0, 0.0;
+            solver.solve_with_low_rank_update(data, block_perm, {1, 2}, delta, {21, 2, 19}, x);
+            check_result(x, x_ref);
+        }
     }
 
     SUBCASE("Block(double 2*2) calculation") {
@@ -125,6 +136,75 @@ TEST_CASE("Test Sparse LU solver") {
             solver.solve_with_prefactorized_matrix((std::vector<Tensor> const&)data, block_perm, rhs, x);
             check_result(x, x_ref);
         }
+
+        SUBCASE("Test low-rank update") {
+            // add identity to the first diagonal block
+            solver.prefactorize(data, block_perm);
+            auto const delta = SparseLUSolver<Tensor, Array, Array>::DenseMatrix::Identity(2, 2);
+            std::vector<Array> const rhs_updated = {{41, 360}, {-389, 2}, {44, 611}};
+            solver.solve_with_low_rank_update(data, block_perm, {0}, delta, rhs_updated, x);
+            check_result(x, x_ref);
+        }
+    }
+
+    SUBCASE("Block(complex 3*3) calculation") {
+        // the Schur complement of complex blocks is updated in split complex form
+        using ComplexBlock = Eigen::Array33cd;
+        using ComplexArray = Eigen::Array3cd;
+        ComplexBlock const pivot{{4.0 + 1.0i, 1.0, 0.5i}, {0.0, 3.0 - 1.0i, 1.0}, {2.0, 0.5, 5.0 + 2.0i}};
+        ComplexBlock const off_diagonal{{1.0, -0.5i, 0.0}, {0.5, 1.0 + 1.0i, -1.0}, {0.0, 2.0i, 0.5}};
+        ComplexBlock const zero = ComplexBlock::Zero();
+        std::vector<ComplexBlock> data = {
+            pivot,                                // 0, 0
+            off_diagonal,                         // 0, 1
+            off_diagonal.transpose(),             // 0, 2
+            off_diagonal,                         // 1, 0
+            2.0 * pivot,                          // 1, 1
+            zero,                                 // 1, 2
+            -off_diagonal,                        // 2, 0
+            zero,                                 // 2, 1
+            pivot + ComplexBlock::Constant(1.0i), // 2, 2
+        };
+        std::vector<ComplexArray> const x_ref = {{1.0, 2.0i, -1.0}, {0.5 - 1.0i, 3.0, 1.0i}, {-2.0, 1.0 + 1.0i, 0.0}};
+        std::vector<ComplexArray> rhs(3, ComplexArray::Zero());
+        for (Idx row = 0; row != 3; ++row) {
+            for (Idx col = 0; col != 3; ++col) {
+                rhs[row] += (data[row * 3 + col].matrix() * x_ref[col].matrix()).array();
+            }
+        }
+        std::vector<ComplexArray> x(3, ComplexArray::Zero());
+        SparseLUSolver<ComplexBlock, ComplexArray, ComplexArray> solver{row_indptr, col_indices, diag_lu};
+        SparseLUSolver<ComplexBlock, ComplexArray, ComplexArray>::BlockPermArray block_perm(3);
+
+        solver.prefactorize_and_solve(data, block_perm, rhs, x);
+        check_result(x, x_ref);
+    }
+}
+
+TEST_CASE("Test block factorization with partial pivoting") {
+    using BlockPerm = lu_trait_tensor::BlockPerm;
+    Eigen::Array33cd const a{{0.0, 2.0 + 1.0i, 1.0}, {4.0, 1.0, -1.0i}, {2.0i, 3.0, 5.0}};
+
+    SUBCASE("Non-singular block") {
+        Eigen::Array33cd lu = a;
+        BlockPerm block_perm{};
+        CHECK(factorize_block_in_place(lu, block_perm));
+        // the largest entry in the first column is chosen as first pivot
+        CHECK(block_perm.row_swap[0] == 1);
+
+        // P * A = L * U
+        Eigen::Matrix3cd const l = Eigen::Matrix3cd{lu.matrix().triangularView<Eigen::UnitLower>()};
+        Eigen::Matrix3cd const u = Eigen::Matrix3cd{lu.matrix().triangularView<Eigen::Upper>()};
+        Eigen::Array33cd pa = a;
+        permute_block_rows(block_perm, pa);
+        CHECK((cabs(pa - (l * u).array()) < numerical_tolerance).all());
+    }
+
+    SUBCASE("Singular block") {
+        Eigen::Array33cd lu = a;
+        lu.row(2) = 2.0 * a.row(0);
+        BlockPerm block_perm{};
+        CHECK(!factorize_block_in_place(lu, block_perm));
     }
 }
 
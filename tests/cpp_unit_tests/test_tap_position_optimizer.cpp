@@ -333,6 +333,38 @@ TEST_CASE("Test Transformer ranking") {
                                                              {Idx2D{3, 3}, Idx2D{3, 2}, Idx2D{3, 4}}};
             CHECK(order == ref_order);
         }
+
+        SUBCASE("Ranking cache") {
+            Idx n_rankings{0};
+            auto const ranker = [&n_rankings](TestState const& state_) {
+                ++n_rankings;
+                return pgm_tap::rank_transformers(state_);
+            };
+            pgm_tap::RankedTransformerGroups const ref_order{{Idx2D{3, 0}, Idx2D{3, 1}, Idx2D{4, 0}},
+                                                             {Idx2D{3, 3}, Idx2D{3, 2}, Idx2D{3, 4}}};
+
+            pgm_tap::RegulatorOrderCache cache;
+            cache.refresh(state, ranker);
+            CHECK(n_rankings == 1);
+            CHECK(cache.order() == ref_order);
+            for (auto const& regulator : regulators) {
+                CHECK(pgm_tap::find_regulator(state, cache.regulator_index(), regulator.regulated_object).id() ==
+                      regulator.id);
+            }
+
+            // tap positions do not change the ranking
+            main_core::get_component<Transformer>(state, 14).update(TransformerUpdate{.id = 14, .tap_pos = 1});
+            cache.refresh(state, ranker);
+            CHECK(n_rankings == 1);
+
+            // disabled regulator
+            main_core::get_component<TransformerTapRegulator>(state, 26).update(
+                TransformerTapRegulatorUpdate{.id = 26, .status = 0});
+            cache.refresh(state, ranker);
+            CHECK(n_rankings == 2);
+            CHECK(cache.order() == pgm_tap::rank_transformers(state));
+            CHECK(cache.order() != ref_order);
+        }
     }
 }
 
@@ -567,6 +599,7 @@ auto check_exact_per_strategy(IntS tap_pos_any, IntS tap_pos_min, IntS tap_pos_m
 
         switch (strategy) {
         case any:
+        case fast_any:
             CHECK(value == tap_pos_any);
             break;
         case local_maximum:
@@ -657,6 +690,36 @@ TEST_CASE("Test Tap position optimizer") {
                                                      std::back_inserter(changed_components));
     };
 
+    // updates the transformers in place, the dataset path should never be taken
+    auto const direct_updater = [&state]<typename UpdateData>(UpdateData const& update_data) {
+        if constexpr (std::same_as<UpdateData, ConstDataset>) {
+            FAIL("Direct state update expected");
+        } else {
+            static_assert(std::same_as<typename UpdateData::ComponentType, MockTransformer>);
+            REQUIRE(update_data.updates.size() == update_data.sequence_idx.size());
+            auto changed_components = std::vector<Idx2D>{};
+            main_core::update_component<MockTransformer>(state, update_data.updates.begin(),
+                                                         update_data.updates.end(),
+                                                         std::back_inserter(changed_components),
+                                                         update_data.sequence_idx);
+        }
+    };
+    static_assert(!optimizer::direct_state_updater_c<decltype(updater), MockTransformer>);
+    static_assert(optimizer::direct_state_updater_c<decltype(direct_updater), MockTransformer>);
+
+    // starts from the previous result if it is given
+    auto const warm_start_calculator = [](MockState const& state_, CalculationMethod method,
+                                          std::vector<test::MockSolverOutput<MockContainer>> const&
+                                              previous_result = {}) {
+        if (!previous_result.empty()) {
+            CHECK(previous_result.size() == 1);
+            CHECK(previous_result.front().method == method);
+        }
+        return test::mock_state_calculator(state_, method);
+    };
+    static_assert(!optimizer::detail::warm_start_calculator_c<MockStateCalculator, MockState>);
+    static_assert(optimizer::detail::warm_start_calculator_c<decltype(warm_start_calculator), MockState>);
+
     auto twoStatesEqual = [](const MockState& state1, const MockState& state2) {
         if (state1.components.template size<MockTransformer>() != state2.components.template size<MockTransformer>()) {
             return false;
@@ -681,6 +744,11 @@ TEST_CASE("Test Tap position optimizer") {
         return pgm_tap::TapPositionOptimizer<MockStateCalculator, decltype(updater), MockState, MockTransformerRanker>{
             test::mock_state_calculator, updater, strategy, meta_data};
     };
+    auto const get_direct_optimizer = [&](OptimizerStrategy strategy) {
+        return pgm_tap::TapPositionOptimizer<decltype(warm_start_calculator), decltype(direct_updater), MockState,
+                                             MockTransformerRanker>{warm_start_calculator, direct_updater, strategy,
+                                                                    meta_data};
+    };
 
     SUBCASE("empty state") {
         state.components.set_construction_complete();
@@ -794,6 +862,7 @@ TEST_CASE("Test Tap position optimizer") {
                     switch (strategy) {
                         using enum OptimizerStrategy;
                     case any:
+                    case fast_any:
                         CHECK(value == state_b.tap_pos);
                         break;
                     case local_maximum:
@@ -1039,6 +1108,15 @@ TEST_CASE("Test Tap position optimizer") {
                     // reset
                     CHECK(transformer_a.tap_pos() == initial_a);
                     CHECK(transformer_b.tap_pos() == initial_b);
+
+                    // direct state update and warm started calculations give the same optimum
+                    auto direct_optimizer = get_direct_optimizer(strategy);
+                    auto const direct_result = direct_optimizer.optimize(state, CalculationMethod::default_method);
+                    REQUIRE(direct_result.solver_output.size() == 1);
+                    check_a(direct_result.solver_output.front().state_tap_positions.at(state_a.id), strategy);
+                    check_b(direct_result.solver_output.front().state_tap_positions.at(state_b.id), strategy);
+                    CHECK(transformer_a.tap_pos() == initial_a);
+                    CHECK(transformer_b.tap_pos() == initial_b);
                 }
             }
         }
@@ -1081,6 +1159,73 @@ TEST_CASE("Test Tap position optimizer") {
     }
 }
 
+TEST_CASE("Test tap position search") {
+    using pgm_tap::TapPositionSearch;
+
+    // control voltage decreases linearly with the tap step, in band at step 6 and 7 only
+    constexpr Idx n_steps = 10;
+    auto const voltage = [](Idx step) { return 1.2 - 0.05 * static_cast<double>(step); };
+    auto const compare = [&voltage](Idx step) {
+        return voltage(step) <=> pgm_tap::VoltageBand{.u_set = 0.88, .u_band = 0.07};
+    };
+    auto const search_from = [&compare](Idx step, auto next_step) {
+        Idx n_calculations = 1;
+        for (Idx next = next_step(step); next != step; next = next_step(step)) {
+            step = next;
+            ++n_calculations;
+            REQUIRE(n_calculations <= n_steps + 1);
+        }
+        CHECK(compare(step) == 0);
+        return std::pair{step, n_calculations};
+    };
+
+    SUBCASE("Bisection for maximum voltage") {
+        TapPositionSearch search{n_steps};
+        auto const [step, n_calculations] =
+            search_from(0, [&](Idx current) { return search.bisect(current, compare(current), true); });
+        CHECK(step == 6);
+        CHECK(n_calculations < 6);
+    }
+
+    SUBCASE("Bisection for minimum voltage") {
+        TapPositionSearch search{n_steps};
+        auto const [step, n_calculations] =
+            search_from(n_steps, [&](Idx current) { return search.bisect(current, compare(current), false); });
+        CHECK(step == 7);
+        CHECK(n_calculations <= 4);
+    }
+
+    SUBCASE("Refinement in the bracket of the first pass") {
+        TapPositionSearch search{n_steps};
+        auto const [step, n_calculations] =
+            search_from(0, [&](Idx current) { return search.bisect(current, compare(current), true); });
+        REQUIRE(step == 6);
+        // one step towards a higher voltage is out of band, so the search returns without bisecting again
+        auto const [refined_step, n_refinements] =
+            search_from(step - 1, [&](Idx current) { return search.bisect(current, compare(current), true); });
+        CHECK(refined_step == 6);
+        CHECK(n_refinements == 2);
+    }
+
+    SUBCASE("Prediction from sensitivity") {
+        TapPositionSearch search{n_steps};
+        auto const [step, n_calculations] = search_from(0, [&](Idx current) {
+            return search.predict(current, compare(current), voltage(current), 0.88);
+        });
+        CHECK(step == 6);
+        // one step to estimate the sensitivity, one jump, and the verification
+        CHECK(n_calculations == 3);
+    }
+
+    SUBCASE("Restart") {
+        TapPositionSearch search{n_steps};
+        CHECK(search.bisect(0, std::partial_ordering::greater, true) == 5);
+        CHECK(search.bisect(5, std::partial_ordering::greater, true) == 8);
+        search.restart();
+        CHECK(search.bisect(2, std::partial_ordering::less, true) == 0);
+    }
+}
+
 TEST_CASE("Test tap position optmizer I/O") {
     SUBCASE("transformer duplicatively regulated") {
         test::TestState state_mini;
@@ -161,6 +161,23 @@ TEST_CASE("Three phase tensor") {
         CHECK((hermitian_transpose(z2) == z2ht).all());
     }
 
+    SUBCASE("Test split complex product") {
+        ComplexTensor<asymmetric_t> x;
+        x << 1.0 + 5.0i, 3.0 - 4.0i, 2.0i, 0.5, 1.0, -1.0i, 2.0 + 1.0i, 0.0, 3.0;
+        ComplexValue<asymmetric_t> const y{1.0 - 1.0i, 2.0i, 3.0};
+        ComplexValue<asymmetric_t> const y_ref = dot(x, y);
+        ComplexTensor<asymmetric_t> const x_ref = dot(x, x);
+
+        auto const split_x = split_complex(x);
+        auto const split_y = dot(split_x, split_complex(y));
+        CHECK((cabs(y_ref.real() - split_y.real.array()) < numerical_tolerance).all());
+        CHECK((cabs(y_ref.imag() - split_y.imag.array()) < numerical_tolerance).all());
+
+        ComplexTensor<asymmetric_t> z = x_ref;
+        subtract_dot(z, split_x, split_x);
+        CHECK((cabs(z) < numerical_tolerance).all());
+    }
+
     SUBCASE("Test average of nan") {
         DoubleComplex const x{1.0, nan};
         DoubleComplex const y{2.0, 2.0};